@@ -0,0 +1,74 @@
+#pragma once
+// AlignedArray.h
+// Fixed-size array like Array<T,N>, but over-aligned (default 32 bytes, one
+// AVX register) so SIMD kernels can use aligned loads, and usable in
+// constant expressions. Kernels live in ArrayKernels.h.
+#ifndef ALIGNED_ARRAY_H
+#define ALIGNED_ARRAY_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <stdexcept>
+
+template <class T, std::size_t N, std::size_t Align = 32>
+class AlignedArray {
+    static_assert((Align & (Align - 1)) == 0 && Align >= alignof(T), "bad alignment");
+
+private:
+    alignas(Align) T data_[N] = {};
+
+public:
+    constexpr AlignedArray() = default;
+    // {a, b, c}: missing trailing elements stay value-initialized
+    constexpr AlignedArray(std::initializer_list<T> il) {
+        if (il.size() > N) throw std::invalid_argument("AlignedArray size mismatch");
+        std::size_t i = 0;
+        for (const T& x : il) data_[i++] = x;
+    }
+    static constexpr AlignedArray filled(const T& v) {
+        AlignedArray a;
+        for (std::size_t i = 0; i < N; ++i) a.data_[i] = v;
+        return a;
+    }
+
+    static constexpr std::size_t alignment() { return Align; }
+    constexpr std::size_t size() const { return N; }
+    constexpr bool empty() const { return N == 0; }
+
+    constexpr T& operator[](std::size_t i) { return data_[i]; }
+    constexpr const T& operator[](std::size_t i) const { return data_[i]; }
+
+    constexpr T& at(std::size_t i) {
+        if (i >= N) throw std::out_of_range("at");
+        return data_[i];
+    }
+    constexpr const T& at(std::size_t i) const {
+        if (i >= N) throw std::out_of_range("at");
+        return data_[i];
+    }
+
+    constexpr void fill(const T& v) {
+        for (std::size_t i = 0; i < N; ++i) data_[i] = v;
+    }
+
+    // iteration helpers
+    constexpr T* data() { return data_; }
+    constexpr const T* data() const { return data_; }
+    constexpr T* begin() { return data_; }
+    constexpr T* end() { return data_ + N; }
+    constexpr const T* begin() const { return data_; }
+    constexpr const T* end()   const { return data_ + N; }
+};
+
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator==(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b) {
+    for (std::size_t i = 0; i < N; ++i)
+        if (!(a[i] == b[i])) return false;
+    return true;
+}
+template <class T, std::size_t N, std::size_t A>
+constexpr bool operator!=(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b) {
+    return !(a == b);
+}
+
+#endif
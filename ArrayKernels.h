@@ -0,0 +1,409 @@
+#pragma once
+// ArrayKernels.h
+// Elementwise and reduction kernels over AlignedArray<T,N>.
+//
+//   add/sub/mul(a, b, out)      out[i] = a[i] op b[i]
+//   fma(a, b, c, out)           out[i] = a[i] * b[i] + c[i]
+//   min/max(a, b, out)          elementwise min / max
+//   dot(a, b), sum(a)           reductions (SIMD lanes are summed at the end,
+//   minOf(a), maxOf(a)          so float results can differ in the last bits
+//   reduce(a, init, op)         from a left-to-right loop); reduce is scalar
+//   less/equal/greater(a, b)    compare, returning a Mask<N> of lanes
+//   select(mask, a, b, out)     out[i] = mask[i] ? a[i] : b[i]
+//
+// float, double and int32_t use SSE/AVX when the compiler targets them
+// (-mavx2 -mfma picks the 256-bit path; x86-64 always has SSE2). Other T,
+// and the N % lanes tail, go through the plain loops. out may alias inputs.
+#ifndef ARRAY_KERNELS_H
+#define ARRAY_KERNELS_H
+
+#include "AlignedArray.h"
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// one bit per lane
+template <std::size_t N>
+struct Mask {
+    static constexpr std::size_t kWords = (N + 63) / 64;
+    std::uint64_t words[kWords] = {};
+
+    bool test(std::size_t i) const { return (words[i / 64] >> (i % 64)) & 1u; }
+    void set(std::size_t i) { words[i / 64] |= std::uint64_t(1) << (i % 64); }
+    // OR in `count` bits starting at lane i (i is a multiple of count)
+    void setBits(std::size_t i, std::uint64_t bits) { words[i / 64] |= bits << (i % 64); }
+    std::size_t count() const {
+        std::size_t c = 0;
+        for (std::size_t w = 0; w < kWords; ++w) {
+#if defined(__GNUC__)
+            c += (std::size_t)__builtin_popcountll(words[w]);
+#else
+            std::uint64_t x = words[w];
+            while (x) { x &= x - 1; ++c; }
+#endif
+        }
+        return c;
+    }
+    bool any() const {
+        for (std::size_t w = 0; w < kWords; ++w)
+            if (words[w]) return true;
+        return false;
+    }
+    bool operator[](std::size_t i) const { return test(i); }
+};
+
+namespace ArrayKernels {
+namespace detail {
+
+// SIMD traits: lanes, load/store and the lane ops. Specializations exist
+// only where an instruction set backs them; Simd<T>::enabled is false
+// otherwise and the kernels use their scalar loops.
+template <class T>
+struct Simd { static constexpr bool enabled = false; static constexpr std::size_t lanes = 1; };
+
+#if defined(__AVX__)
+template <>
+struct Simd<float> {
+    using V = __m256;
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 8;
+    template <bool A> static V load(const float* p) { return A ? _mm256_load_ps(p) : _mm256_loadu_ps(p); }
+    template <bool A> static void store(float* p, V v) { if (A) _mm256_store_ps(p, v); else _mm256_storeu_ps(p, v); }
+    static V zero() { return _mm256_setzero_ps(); }
+    static V add(V a, V b) { return _mm256_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm256_mul_ps(a, b); }
+#if defined(__FMA__)
+    static V fma(V a, V b, V c) { return _mm256_fmadd_ps(a, b, c); }
+#else
+    static V fma(V a, V b, V c) { return _mm256_add_ps(_mm256_mul_ps(a, b), c); }
+#endif
+    static V min(V a, V b) { return _mm256_min_ps(a, b); }
+    static V max(V a, V b) { return _mm256_max_ps(a, b); }
+    static unsigned lt(V a, V b) { return (unsigned)_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_LT_OQ)); }
+    static unsigned eq(V a, V b) { return (unsigned)_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_EQ_OQ)); }
+    static unsigned gt(V a, V b) { return (unsigned)_mm256_movemask_ps(_mm256_cmp_ps(a, b, _CMP_GT_OQ)); }
+};
+template <>
+struct Simd<double> {
+    using V = __m256d;
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 4;
+    template <bool A> static V load(const double* p) { return A ? _mm256_load_pd(p) : _mm256_loadu_pd(p); }
+    template <bool A> static void store(double* p, V v) { if (A) _mm256_store_pd(p, v); else _mm256_storeu_pd(p, v); }
+    static V zero() { return _mm256_setzero_pd(); }
+    static V add(V a, V b) { return _mm256_add_pd(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_pd(a, b); }
+    static V mul(V a, V b) { return _mm256_mul_pd(a, b); }
+#if defined(__FMA__)
+    static V fma(V a, V b, V c) { return _mm256_fmadd_pd(a, b, c); }
+#else
+    static V fma(V a, V b, V c) { return _mm256_add_pd(_mm256_mul_pd(a, b), c); }
+#endif
+    static V min(V a, V b) { return _mm256_min_pd(a, b); }
+    static V max(V a, V b) { return _mm256_max_pd(a, b); }
+    static unsigned lt(V a, V b) { return (unsigned)_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_LT_OQ)); }
+    static unsigned eq(V a, V b) { return (unsigned)_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_EQ_OQ)); }
+    static unsigned gt(V a, V b) { return (unsigned)_mm256_movemask_pd(_mm256_cmp_pd(a, b, _CMP_GT_OQ)); }
+};
+#elif defined(__SSE2__)
+template <>
+struct Simd<float> {
+    using V = __m128;
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 4;
+    template <bool A> static V load(const float* p) { return A ? _mm_load_ps(p) : _mm_loadu_ps(p); }
+    template <bool A> static void store(float* p, V v) { if (A) _mm_store_ps(p, v); else _mm_storeu_ps(p, v); }
+    static V zero() { return _mm_setzero_ps(); }
+    static V add(V a, V b) { return _mm_add_ps(a, b); }
+    static V sub(V a, V b) { return _mm_sub_ps(a, b); }
+    static V mul(V a, V b) { return _mm_mul_ps(a, b); }
+    static V fma(V a, V b, V c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    static V min(V a, V b) { return _mm_min_ps(a, b); }
+    static V max(V a, V b) { return _mm_max_ps(a, b); }
+    static unsigned lt(V a, V b) { return (unsigned)_mm_movemask_ps(_mm_cmplt_ps(a, b)); }
+    static unsigned eq(V a, V b) { return (unsigned)_mm_movemask_ps(_mm_cmpeq_ps(a, b)); }
+    static unsigned gt(V a, V b) { return (unsigned)_mm_movemask_ps(_mm_cmpgt_ps(a, b)); }
+};
+template <>
+struct Simd<double> {
+    using V = __m128d;
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 2;
+    template <bool A> static V load(const double* p) { return A ? _mm_load_pd(p) : _mm_loadu_pd(p); }
+    template <bool A> static void store(double* p, V v) { if (A) _mm_store_pd(p, v); else _mm_storeu_pd(p, v); }
+    static V zero() { return _mm_setzero_pd(); }
+    static V add(V a, V b) { return _mm_add_pd(a, b); }
+    static V sub(V a, V b) { return _mm_sub_pd(a, b); }
+    static V mul(V a, V b) { return _mm_mul_pd(a, b); }
+    static V fma(V a, V b, V c) { return _mm_add_pd(_mm_mul_pd(a, b), c); }
+    static V min(V a, V b) { return _mm_min_pd(a, b); }
+    static V max(V a, V b) { return _mm_max_pd(a, b); }
+    static unsigned lt(V a, V b) { return (unsigned)_mm_movemask_pd(_mm_cmplt_pd(a, b)); }
+    static unsigned eq(V a, V b) { return (unsigned)_mm_movemask_pd(_mm_cmpeq_pd(a, b)); }
+    static unsigned gt(V a, V b) { return (unsigned)_mm_movemask_pd(_mm_cmpgt_pd(a, b)); }
+};
+#endif
+
+#if defined(__AVX2__)
+template <>
+struct Simd<std::int32_t> {
+    using V = __m256i;
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 8;
+    template <bool A> static V load(const std::int32_t* p) {
+        return A ? _mm256_load_si256(reinterpret_cast<const V*>(p)) : _mm256_loadu_si256(reinterpret_cast<const V*>(p));
+    }
+    template <bool A> static void store(std::int32_t* p, V v) {
+        if (A) _mm256_store_si256(reinterpret_cast<V*>(p), v); else _mm256_storeu_si256(reinterpret_cast<V*>(p), v);
+    }
+    static V zero() { return _mm256_setzero_si256(); }
+    static V add(V a, V b) { return _mm256_add_epi32(a, b); }
+    static V sub(V a, V b) { return _mm256_sub_epi32(a, b); }
+    static V mul(V a, V b) { return _mm256_mullo_epi32(a, b); }
+    static V fma(V a, V b, V c) { return _mm256_add_epi32(_mm256_mullo_epi32(a, b), c); }
+    static V min(V a, V b) { return _mm256_min_epi32(a, b); }
+    static V max(V a, V b) { return _mm256_max_epi32(a, b); }
+    static unsigned bits(V m) { return (unsigned)_mm256_movemask_ps(_mm256_castsi256_ps(m)); }
+    static unsigned lt(V a, V b) { return bits(_mm256_cmpgt_epi32(b, a)); }
+    static unsigned eq(V a, V b) { return bits(_mm256_cmpeq_epi32(a, b)); }
+    static unsigned gt(V a, V b) { return bits(_mm256_cmpgt_epi32(a, b)); }
+};
+#elif defined(__SSE4_1__)
+template <>
+struct Simd<std::int32_t> {
+    using V = __m128i;
+    static constexpr bool enabled = true;
+    static constexpr std::size_t lanes = 4;
+    template <bool A> static V load(const std::int32_t* p) {
+        return A ? _mm_load_si128(reinterpret_cast<const V*>(p)) : _mm_loadu_si128(reinterpret_cast<const V*>(p));
+    }
+    template <bool A> static void store(std::int32_t* p, V v) {
+        if (A) _mm_store_si128(reinterpret_cast<V*>(p), v); else _mm_storeu_si128(reinterpret_cast<V*>(p), v);
+    }
+    static V zero() { return _mm_setzero_si128(); }
+    static V add(V a, V b) { return _mm_add_epi32(a, b); }
+    static V sub(V a, V b) { return _mm_sub_epi32(a, b); }
+    static V mul(V a, V b) { return _mm_mullo_epi32(a, b); }
+    static V fma(V a, V b, V c) { return _mm_add_epi32(_mm_mullo_epi32(a, b), c); }
+    static V min(V a, V b) { return _mm_min_epi32(a, b); }
+    static V max(V a, V b) { return _mm_max_epi32(a, b); }
+    static unsigned bits(V m) { return (unsigned)_mm_movemask_ps(_mm_castsi128_ps(m)); }
+    static unsigned lt(V a, V b) { return bits(_mm_cmplt_epi32(a, b)); }
+    static unsigned eq(V a, V b) { return bits(_mm_cmpeq_epi32(a, b)); }
+    static unsigned gt(V a, V b) { return bits(_mm_cmpgt_epi32(a, b)); }
+};
+#endif
+
+// number of leading elements the SIMD path covers, and whether its
+// loads can be the aligned kind
+template <class T, std::size_t N, std::size_t A>
+struct Plan {
+    using S = Simd<T>;
+    static constexpr std::size_t lanes = S::lanes;
+    static constexpr std::size_t body = S::enabled ? N / lanes * lanes : 0;
+    static constexpr bool aligned = A % (lanes * sizeof(T)) == 0;
+};
+
+template <class T>
+T horizontal(const T* lanes, std::size_t n) {
+    T s = lanes[0];
+    for (std::size_t i = 1; i < n; ++i) s += lanes[i];
+    return s;
+}
+
+} // namespace detail
+
+namespace detail {
+// lane ops: simd<S>() on the SIMD body, scalar() on the tail
+struct AddOp {
+    template <class S, class V> static V simd(V a, V b) { return S::add(a, b); }
+    template <class T> static T scalar(const T& a, const T& b) { return a + b; }
+};
+struct SubOp {
+    template <class S, class V> static V simd(V a, V b) { return S::sub(a, b); }
+    template <class T> static T scalar(const T& a, const T& b) { return a - b; }
+};
+struct MulOp {
+    template <class S, class V> static V simd(V a, V b) { return S::mul(a, b); }
+    template <class T> static T scalar(const T& a, const T& b) { return a * b; }
+};
+struct MinOp {
+    template <class S, class V> static V simd(V a, V b) { return S::min(a, b); }
+    template <class T> static T scalar(const T& a, const T& b) { return (b < a) ? b : a; }
+};
+struct MaxOp {
+    template <class S, class V> static V simd(V a, V b) { return S::max(a, b); }
+    template <class T> static T scalar(const T& a, const T& b) { return (a < b) ? b : a; }
+};
+
+// out[i] = Op(a[i], b[i])
+template <class Op, class T, std::size_t N, std::size_t A>
+void elementwise(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b,
+                 AlignedArray<T, N, A>& out) {
+    using P = Plan<T, N, A>;
+    if constexpr (P::body > 0) {
+        using S = typename P::S;
+        for (std::size_t i = 0; i < P::body; i += P::lanes)
+            S::template store<P::aligned>(out.data() + i,
+                Op::template simd<S>(S::template load<P::aligned>(a.data() + i),
+                                     S::template load<P::aligned>(b.data() + i)));
+    }
+    for (std::size_t i = P::body; i < N; ++i) out[i] = Op::scalar(a[i], b[i]);
+}
+} // namespace detail
+
+template <class T, std::size_t N, std::size_t A>
+void add(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b, AlignedArray<T, N, A>& out) {
+    detail::elementwise<detail::AddOp>(a, b, out);
+}
+template <class T, std::size_t N, std::size_t A>
+void sub(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b, AlignedArray<T, N, A>& out) {
+    detail::elementwise<detail::SubOp>(a, b, out);
+}
+template <class T, std::size_t N, std::size_t A>
+void mul(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b, AlignedArray<T, N, A>& out) {
+    detail::elementwise<detail::MulOp>(a, b, out);
+}
+template <class T, std::size_t N, std::size_t A>
+void min(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b, AlignedArray<T, N, A>& out) {
+    detail::elementwise<detail::MinOp>(a, b, out);
+}
+template <class T, std::size_t N, std::size_t A>
+void max(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b, AlignedArray<T, N, A>& out) {
+    detail::elementwise<detail::MaxOp>(a, b, out);
+}
+
+// out = a * b + c
+template <class T, std::size_t N, std::size_t A>
+void fma(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b,
+         const AlignedArray<T, N, A>& c, AlignedArray<T, N, A>& out) {
+    using P = detail::Plan<T, N, A>;
+    if constexpr (P::body > 0) {
+        using S = typename P::S;
+        for (std::size_t i = 0; i < P::body; i += P::lanes)
+            S::template store<P::aligned>(out.data() + i,
+                S::fma(S::template load<P::aligned>(a.data() + i),
+                       S::template load<P::aligned>(b.data() + i),
+                       S::template load<P::aligned>(c.data() + i)));
+    }
+    for (std::size_t i = P::body; i < N; ++i) out[i] = a[i] * b[i] + c[i];
+}
+
+template <class T, std::size_t N, std::size_t A>
+T dot(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b) {
+    using P = detail::Plan<T, N, A>;
+    T s = T();
+    if constexpr (P::body > 0) {
+        using S = typename P::S;
+        typename S::V acc = S::zero();
+        for (std::size_t i = 0; i < P::body; i += P::lanes)
+            acc = S::fma(S::template load<P::aligned>(a.data() + i),
+                         S::template load<P::aligned>(b.data() + i), acc);
+        alignas(64) T lanes[P::lanes];
+        S::template store<false>(lanes, acc);
+        s = detail::horizontal(lanes, P::lanes);
+    }
+    for (std::size_t i = P::body; i < N; ++i) s += a[i] * b[i];
+    return s;
+}
+
+template <class T, std::size_t N, std::size_t A>
+T sum(const AlignedArray<T, N, A>& a) {
+    using P = detail::Plan<T, N, A>;
+    T s = T();
+    if constexpr (P::body > 0) {
+        using S = typename P::S;
+        typename S::V acc = S::zero();
+        for (std::size_t i = 0; i < P::body; i += P::lanes)
+            acc = S::add(acc, S::template load<P::aligned>(a.data() + i));
+        alignas(64) T lanes[P::lanes];
+        S::template store<false>(lanes, acc);
+        s = detail::horizontal(lanes, P::lanes);
+    }
+    for (std::size_t i = P::body; i < N; ++i) s += a[i];
+    return s;
+}
+
+// generic left fold; scalar, op is arbitrary
+template <class T, std::size_t N, std::size_t A, class Op>
+T reduce(const AlignedArray<T, N, A>& a, T init, Op op) {
+    for (std::size_t i = 0; i < N; ++i) init = op(init, a[i]);
+    return init;
+}
+
+namespace detail {
+template <bool Max, class T, std::size_t N, std::size_t A>
+T extreme(const AlignedArray<T, N, A>& a) {
+    using P = Plan<T, N, A>;
+    static_assert(N > 0, "minOf/maxOf of an empty array");
+    T best = a[0];
+    if constexpr (P::body > 0) {
+        using S = typename P::S;
+        typename S::V acc = S::template load<P::aligned>(a.data());
+        for (std::size_t i = P::lanes; i < P::body; i += P::lanes) {
+            typename S::V v = S::template load<P::aligned>(a.data() + i);
+            acc = Max ? S::max(acc, v) : S::min(acc, v);
+        }
+        alignas(64) T lanes[P::lanes];
+        S::template store<false>(lanes, acc);
+        best = lanes[0];
+        for (std::size_t i = 1; i < P::lanes; ++i)
+            if (Max ? best < lanes[i] : lanes[i] < best) best = lanes[i];
+    }
+    for (std::size_t i = P::body; i < N; ++i)
+        if (Max ? best < a[i] : a[i] < best) best = a[i];
+    return best;
+}
+
+template <int Cmp, class T, std::size_t N, std::size_t A>
+Mask<N> compare(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b) {
+    using P = Plan<T, N, A>;
+    Mask<N> m;
+    if constexpr (P::body > 0) {
+        using S = typename P::S;
+        for (std::size_t i = 0; i < P::body; i += P::lanes) {
+            typename S::V x = S::template load<P::aligned>(a.data() + i);
+            typename S::V y = S::template load<P::aligned>(b.data() + i);
+            unsigned bits = Cmp < 0 ? S::lt(x, y) : Cmp == 0 ? S::eq(x, y) : S::gt(x, y);
+            m.setBits(i, bits);
+        }
+    }
+    // scalar lanes: build each word in a register, branch-free
+    for (std::size_t i = P::body; i < N;) {
+        std::size_t w = i / 64, stop = (w + 1) * 64 < N ? (w + 1) * 64 : N;
+        std::uint64_t bits = 0;
+        for (; i < stop; ++i) {
+            bool hit = Cmp < 0 ? a[i] < b[i] : Cmp == 0 ? a[i] == b[i] : b[i] < a[i];
+            bits |= std::uint64_t(hit) << (i % 64);
+        }
+        m.words[w] |= bits;
+    }
+    return m;
+}
+} // namespace detail
+
+template <class T, std::size_t N, std::size_t A>
+T minOf(const AlignedArray<T, N, A>& a) { return detail::extreme<false>(a); }
+template <class T, std::size_t N, std::size_t A>
+T maxOf(const AlignedArray<T, N, A>& a) { return detail::extreme<true>(a); }
+
+template <class T, std::size_t N, std::size_t A>
+Mask<N> less(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b) { return detail::compare<-1>(a, b); }
+template <class T, std::size_t N, std::size_t A>
+Mask<N> equal(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b) { return detail::compare<0>(a, b); }
+template <class T, std::size_t N, std::size_t A>
+Mask<N> greater(const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b) { return detail::compare<1>(a, b); }
+
+template <class T, std::size_t N, std::size_t A>
+void select(const Mask<N>& m, const AlignedArray<T, N, A>& a, const AlignedArray<T, N, A>& b,
+            AlignedArray<T, N, A>& out) {
+    for (std::size_t i = 0; i < N; ++i) out[i] = m.test(i) ? a[i] : b[i];
+}
+
+} // namespace ArrayKernels
+
+#endif
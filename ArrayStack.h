@@ -0,0 +1,48 @@
+#pragma once
+// ArrayStack.h
+// Stack over contiguous storage: the top is the last element of a
+// SmallVector, so push/pop are a bounds check plus a construct/destroy and
+// the first N elements never touch the heap. Same interface as Stack.h.
+#ifndef ARRAY_STACK_H
+#define ARRAY_STACK_H
+
+#include "SmallVector.h"
+#include <cstddef>
+#include <stdexcept>
+#include <utility>
+
+template <class T, std::size_t N = 16>
+class ArrayStack {
+private:
+    SmallVector<T, N> data;   // top of stack is data[size - 1]
+
+public:
+    bool isEmpty() const { return data.empty(); }
+    std::size_t getSize() const { return data.size(); }
+    void clear() { data.clear(); }
+
+    // keeps room for n elements; more than N moves the stack to the heap
+    void reserve(std::size_t n) { data.reserve(n); }
+
+    void push(const T& x) { data.push_back(x); }            // amortized O(1)
+    void push(T&& x) { data.push_back(std::move(x)); }
+
+    template <class... Args>
+    T& emplace(Args&&... args) { return data.emplace_back(std::forward<Args>(args)...); }
+
+    void pop() {                                            // O(1)
+        if (isEmpty()) throw std::out_of_range("pop on empty stack");
+        data.pop_back();
+    }
+
+    T& top() {
+        if (isEmpty()) throw std::out_of_range("top on empty stack");
+        return data[data.size() - 1];
+    }
+    const T& top() const {
+        if (isEmpty()) throw std::out_of_range("top on empty stack");
+        return data[data.size() - 1];
+    }
+};
+
+#endif
@@ -5,10 +5,10 @@
 #include "LinkedList.h"
 #include <cstddef>
 
-template <class T>
+template <class T, class NodeAlloc = NewNodeAlloc>
 class Bag {
 private:
-    LinkedList<T> data;
+    LinkedList<T, NodeAlloc> data;
 
 public:
     bool        isEmpty() const { return data.getLength() == 0; }
@@ -16,29 +16,34 @@ public:
     void        clear() { data.clear(); }
 
     bool add(const T& item) {
-        return data.insert(data.getLength() + 1, item);
+        data.push_back(item);
+        return true;
     }
 
+    // single pass, remembering the previous node so we can unlink in O(1)
     bool remove(const T& item) {
-        for (std::size_t i = 1; i <= data.getLength(); ++i) {
-            if (data.getEntry(i) == item) {
-                return data.remove(i);
+        auto prev = data.end();
+        for (auto it = data.begin(); it != data.end(); prev = it, ++it) {
+            if (*it == item) {
+                if (prev == data.end()) data.pop_front();
+                else data.eraseAfter(prev);
+                return true;
             }
         }
         return false;
     }
 
     bool contains(const T& item) const {
-        for (std::size_t i = 1; i <= data.getLength(); ++i) {
-            if (data.getEntry(i) == item) return true;
+        for (const T& x : data) {
+            if (x == item) return true;
         }
         return false;
     }
 
     std::size_t getFrequencyOf(const T& item) const {
         std::size_t count = 0;
-        for (std::size_t i = 1; i <= data.getLength(); ++i) {
-            if (data.getEntry(i) == item) ++count;
+        for (const T& x : data) {
+            if (x == item) ++count;
         }
         return count;
     }
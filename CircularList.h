@@ -1,30 +1,285 @@
 #pragma once
 // CircularList.h
-// A simple circular traversal built on top of LinkedList
-
+// A real ring: singly linked nodes where the tail links back to the head.
+// The list holds only the tail (head is tail->next) plus a cursor, kept as
+// the node *before* the cursor element so the cursor element can be
+// unlinked in O(1).
+//
+//   rotate(k)          head moves k places on: O(k), O(1) for small k
+//   advance(k)         cursor moves k places on: O(k)
+//   removeAtCursor()   O(1); the cursor lands on the next element
+//   viewFrom...()      non-owning lazy range over exactly one loop
 #ifndef CIRCULAR_LIST_H
 #define CIRCULAR_LIST_H
 
-#include "LinkedList.h"
-#include <vector>
+#include "ListInterface.h"
+#include <cstddef>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
+#include <vector>
 
 template <class T>
-class CircularList : public LinkedList<T> {
+class CircularList : public ListInterface<T> {
+private:
+    struct Node {
+        T data;
+        Node* next;
+        Node(const T& item, Node* n = nullptr) : data(item), next(n) {}
+    };
+
+    Node* tail = nullptr;        // tail->next is the head
+    Node* cursorPrev = nullptr;  // cursor element is cursorPrev->next
+    size_t sz = 0;
+
+    Node* head() const { return tail ? tail->next : nullptr; }
+
+    // node at 1-based pos (1..sz)
+    Node* nodeAt(size_t pos) const {
+        if (pos < 1 || pos > sz) throw std::out_of_range("invalid pos");
+        if (pos == sz) return tail;
+        Node* cur = tail->next;
+        for (size_t i = 1; i < pos; ++i) cur = cur->next;
+        return cur;
+    }
+
+    // Link x in after p (p == nullptr only for an empty list). The cursor
+    // keeps pointing at the same element.
+    void linkAfter(Node* p, Node* x) {
+        if (!p) {
+            x->next = x;
+            tail = cursorPrev = x;
+        } else {
+            x->next = p->next;
+            p->next = x;
+            if (p == cursorPrev) cursorPrev = x;
+        }
+        ++sz;
+    }
+
+    // unlink and destroy the node after p; a cursor on it moves on
+    void unlinkAfter(Node* p) {
+        Node* doomed = p->next;
+        if (doomed == p) {
+            tail = cursorPrev = nullptr;
+        } else {
+            p->next = doomed->next;
+            if (doomed == tail) tail = p;
+            if (doomed == cursorPrev) cursorPrev = p;
+        }
+        delete doomed;
+        --sz;
+    }
+
+    void copyFrom(const CircularList& other) {
+        if (!other.tail) return;
+        Node* cur = other.tail->next;
+        Node* mine = nullptr;   // our copy of other's cursorPrev
+        for (size_t i = 0; i < other.sz; ++i, cur = cur->next) {
+            push_back(cur->data);
+            if (cur == other.cursorPrev) mine = tail;
+        }
+        cursorPrev = mine;
+    }
+
+    template <class Ref, class Ptr>
+    class Iter {
+    private:
+        friend class CircularList;
+        template <class, class> friend class Iter;
+        Node* cur = nullptr;
+        size_t left = 0;   // elements still to visit, this one included
+        Iter(Node* n, size_t l) : cur(n), left(l) {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = Ref;
+        using pointer           = Ptr;
+
+        Iter() = default;
+        template <class R2, class P2,
+                  class = typename std::enable_if<std::is_convertible<P2, Ptr>::value>::type>
+        Iter(const Iter<R2, P2>& o) : cur(o.cur), left(o.left) {}
+
+        Ref operator*() const { return cur->data; }
+        Ptr operator->() const { return &cur->data; }
+        Iter& operator++() { cur = cur->next; --left; return *this; }
+        Iter operator++(int) { Iter t = *this; ++*this; return t; }
+        // iterators over one loop are equal when they have the same distance to go
+        friend bool operator==(const Iter& a, const Iter& b) { return a.left == b.left; }
+        friend bool operator!=(const Iter& a, const Iter& b) { return a.left != b.left; }
+    };
+
 public:
+    using iterator       = Iter<T&, T*>;
+    using const_iterator = Iter<const T&, const T*>;
+
+    // One loop around the ring starting at some node, without copying.
+    // Editing the list invalidates it.
+    template <class It>
+    class LoopView {
+    private:
+        friend class CircularList;
+        Node* start;
+        size_t n;
+        LoopView(Node* s, size_t len) : start(s), n(len) {}
+
+    public:
+        It begin() const { return It(start, n); }
+        It end() const { return It(nullptr, 0); }
+        size_t size() const { return n; }
+        bool empty() const { return n == 0; }
+    };
+    using view       = LoopView<iterator>;
+    using const_view = LoopView<const_iterator>;
+
+    CircularList() = default;
+    ~CircularList() override { clear(); }
+
+    CircularList(const CircularList& rhs) { copyFrom(rhs); }
+    CircularList& operator=(const CircularList& rhs) {
+        if (this != &rhs) { clear(); copyFrom(rhs); }
+        return *this;
+    }
+    CircularList(CircularList&& rhs) noexcept : tail(rhs.tail), cursorPrev(rhs.cursorPrev), sz(rhs.sz) {
+        rhs.tail = rhs.cursorPrev = nullptr; rhs.sz = 0;
+    }
+    CircularList& operator=(CircularList&& rhs) noexcept {
+        if (this != &rhs) {
+            clear();
+            tail = rhs.tail; cursorPrev = rhs.cursorPrev; sz = rhs.sz;
+            rhs.tail = rhs.cursorPrev = nullptr; rhs.sz = 0;
+        }
+        return *this;
+    }
+
+    bool   isEmpty() const override { return sz == 0; }
+    size_t getLength() const override { return sz; }
+
+    bool insert(size_t pos, const T& entry) override {
+        if (pos < 1 || pos > sz + 1) return false;
+        if (pos == 1) push_front(entry);
+        else if (pos == sz + 1) push_back(entry);
+        else linkAfter(nodeAt(pos - 1), new Node(entry));
+        return true;
+    }
+
+    bool remove(size_t pos) override {
+        if (pos < 1 || pos > sz) return false;
+        unlinkAfter(pos == 1 ? tail : nodeAt(pos - 1));
+        return true;
+    }
+
+    void clear() override {
+        if (tail) {
+            Node* cur = tail->next;
+            tail->next = nullptr;   // break the ring
+            while (cur) { Node* n = cur->next; delete cur; cur = n; }
+        }
+        tail = cursorPrev = nullptr;
+        sz = 0;
+    }
+
+    T& getEntry(size_t pos) override { return nodeAt(pos)->data; }
+    const T& getEntry(size_t pos) const override { return nodeAt(pos)->data; }
+
+    bool replace(size_t pos, const T& entry) override {
+        if (pos < 1 || pos > sz) return false;
+        nodeAt(pos)->data = entry; return true;
+    }
+
+    // ends, all O(1)
+    T& front() {
+        if (!tail) throw std::out_of_range("front on empty list");
+        return tail->next->data;
+    }
+    const T& front() const {
+        if (!tail) throw std::out_of_range("front on empty list");
+        return tail->next->data;
+    }
+    T& back() {
+        if (!tail) throw std::out_of_range("back on empty list");
+        return tail->data;
+    }
+    const T& back() const {
+        if (!tail) throw std::out_of_range("back on empty list");
+        return tail->data;
+    }
+    void push_front(const T& entry) { linkAfter(tail, new Node(entry)); }
+    void push_back(const T& entry) {
+        Node* x = new Node(entry);
+        linkAfter(tail, x);
+        tail = x;
+    }
+    void pop_front() {
+        if (!tail) throw std::out_of_range("pop_front on empty list");
+        unlinkAfter(tail);
+    }
+
+    // the head moves k places on (element k+1 becomes position 1)
+    void rotate(size_t k) {
+        if (sz == 0) return;
+        for (k %= sz; k > 0; --k) tail = tail->next;
+    }
+
+    // cursor: sits on the first element inserted until moved
+    T& cursor() {
+        if (!cursorPrev) throw std::out_of_range("cursor on empty list");
+        return cursorPrev->next->data;
+    }
+    const T& cursor() const {
+        if (!cursorPrev) throw std::out_of_range("cursor on empty list");
+        return cursorPrev->next->data;
+    }
+    void advance(size_t k = 1) {
+        if (sz == 0) return;
+        for (k %= sz; k > 0; --k) cursorPrev = cursorPrev->next;
+    }
+    void resetCursor() { cursorPrev = tail; }                    // back to the head
+    void rotateToCursor() { if (cursorPrev) tail = cursorPrev; } // cursor becomes the head
+    // removes the cursor element; the cursor moves to the one after it
+    void removeAtCursor() {
+        if (!cursorPrev) throw std::out_of_range("removeAtCursor on empty list");
+        unlinkAfter(cursorPrev);
+    }
+    // inserts right after the cursor element; the cursor stays put
+    void insertAfterCursor(const T& entry) {
+        if (!cursorPrev) { linkAfter(nullptr, new Node(entry)); return; }
+        Node* at = cursorPrev->next;
+        linkAfter(at, new Node(entry));
+        if (at == tail) tail = at->next;
+    }
+
+    // one loop from the head, the cursor, or 1-based startIndex (O(startIndex))
+    view viewFromHead() { return view(head(), sz); }
+    const_view viewFromHead() const { return const_view(head(), sz); }
+    view viewFromCursor() { return view(cursorPrev ? cursorPrev->next : nullptr, sz); }
+    const_view viewFromCursor() const { return const_view(cursorPrev ? cursorPrev->next : nullptr, sz); }
+    view viewFrom(size_t startIndex) {
+        if (sz == 0) return view(nullptr, 0);
+        return view(nodeAt(startIndex), sz);
+    }
+    const_view viewFrom(size_t startIndex) const {
+        if (sz == 0) return const_view(nullptr, 0);
+        return const_view(nodeAt(startIndex), sz);
+    }
+
+    // iterating the list itself is one loop from the head
+    iterator begin() { return iterator(head(), sz); }
+    iterator end() { return iterator(nullptr, 0); }
+    const_iterator begin() const { return const_iterator(head(), sz); }
+    const_iterator end() const { return const_iterator(nullptr, 0); }
+
     // Return exactly one full loop of items starting at startIndex (1-based).
-    // If n=4 and startIndex=3 -> [3,4,1,2]
+    // If n=4 and startIndex=3 -> [3,4,1,2]. Copies; viewFrom doesn't.
     std::vector<T> traverseFrom(std::size_t startIndex) const {
         std::vector<T> out;
-        std::size_t n = this->getLength();
-        if (n == 0) return out;
-        if (startIndex < 1 || startIndex > n) throw std::out_of_range("startIndex");
-
-        out.reserve(n);
-        for (std::size_t i = 0; i < n; ++i) {
-            std::size_t pos = ((startIndex - 1 + i) % n) + 1; // wrap with modulo
-            out.push_back(this->getEntry(pos));
-        }
+        if (sz == 0) return out;
+        if (startIndex < 1 || startIndex > sz) throw std::out_of_range("startIndex");
+        out.reserve(sz);
+        for (const T& x : viewFrom(startIndex)) out.push_back(x);
         return out;
     }
 };
@@ -0,0 +1,107 @@
+#pragma once
+// ConcurrentReceiptBag.h
+// Thread-safe ReceiptBag split into independently locked shards.
+//
+// A receipt is an ordinary ReceiptBag receipt with the shard id packed
+// into the top bits of its slot index, so remove/contains go straight to
+// the owning shard and only take that shard's lock. Each thread is
+// assigned a home shard once, round-robin from an atomic counter, and
+// inserts there, so threads spread across shards instead of queueing on
+// one lock. Redeeming a receipt works from any thread.
+#ifndef CONCURRENT_RECEIPT_BAG_H
+#define CONCURRENT_RECEIPT_BAG_H
+
+#include "ReceiptBag.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <stdexcept>
+#include <utility>
+
+template <class T, std::size_t Shards = 16>
+class ConcurrentReceiptBag {
+    static_assert(Shards > 0 && Shards <= 256 && (Shards & (Shards - 1)) == 0,
+                  "Shards must be a power of two up to 256");
+
+public:
+    using Receipt = typename ReceiptBag<T>::Receipt;
+
+private:
+    static constexpr unsigned shardBits() {
+        unsigned b = 0;
+        while (((std::size_t)1 << b) < Shards) ++b;
+        return b;
+    }
+    static constexpr unsigned kShift = 32 - shardBits();   // shard lives in index bits [kShift, 32)
+    static constexpr Receipt kShardMask = (Receipt)(Shards - 1) << kShift;
+
+    // one lock + bag per cache line pair so neighbouring shards don't false-share
+    struct alignas(64) Shard {
+        mutable std::mutex lock;
+        ReceiptBag<T> bag;
+    };
+
+    Shard shards_[Shards];
+
+    // each thread draws a ticket once from a process-wide atomic counter;
+    // its home shard in every bag is ticket mod Shards
+    static std::size_t homeShard() {
+        static std::atomic<std::size_t> nextTicket{0};
+        thread_local const std::size_t ticket = nextTicket.fetch_add(1, std::memory_order_relaxed);
+        return ticket & (Shards - 1);
+    }
+
+    static std::size_t shardOf(Receipt r) { return (std::size_t)((r & kShardMask) >> kShift); }
+    static Receipt inner(Receipt r) { return r & ~kShardMask; }
+
+public:
+    static constexpr std::size_t shardCount() { return Shards; }
+
+    Receipt insert(const T& x) {
+        std::size_t s = homeShard();
+        Receipt r;
+        {
+            std::lock_guard<std::mutex> g(shards_[s].lock);
+            r = shards_[s].bag.insert(x);
+            if (r & kShardMask) {           // slot index grew into the shard bits
+                shards_[s].bag.remove(r);
+                throw std::length_error("ConcurrentReceiptBag shard full");
+            }
+        }
+        return r | ((Receipt)s << kShift);
+    }
+
+    // removes matching receipt; returns the removed item by value
+    T remove(Receipt receipt) {
+        Shard& sh = shards_[shardOf(receipt)];
+        std::lock_guard<std::mutex> g(sh.lock);
+        return sh.bag.remove(inner(receipt));
+    }
+
+    bool contains(Receipt receipt) const {
+        const Shard& sh = shards_[shardOf(receipt)];
+        std::lock_guard<std::mutex> g(sh.lock);
+        return sh.bag.contains(inner(receipt));
+    }
+
+    // copy of the item (a reference would outlive the lock)
+    T get(Receipt receipt) const {
+        const Shard& sh = shards_[shardOf(receipt)];
+        std::lock_guard<std::mutex> g(sh.lock);
+        return sh.bag.get(inner(receipt));
+    }
+
+    // snapshot: shards are counted one after another, not atomically together
+    std::size_t size() const {
+        std::size_t n = 0;
+        for (const Shard& sh : shards_) {
+            std::lock_guard<std::mutex> g(sh.lock);
+            n += sh.bag.size();
+        }
+        return n;
+    }
+    bool isEmpty() const { return size() == 0; }
+};
+
+#endif
@@ -0,0 +1,123 @@
+#pragma once
+// ConcurrentStack.h
+// Lock-free LIFO (Treiber stack) for any number of threads, e.g. a free
+// list shared between workers.
+//
+// Nodes live in a ConcurrentVector and are named by their 32-bit index, so
+// they never move and are never freed while the stack exists: a popped
+// node goes onto an internal free list (itself a Treiber stack) and is
+// reused by a later push. The top of each list is one 64-bit word packing
+// (tag << 32 | index); every successful CAS bumps the tag, so a thread
+// that read the top, stalled while that node was popped and pushed again,
+// and then retries its CAS fails instead of linking in a stale next (the
+// ABA problem). A plain 64-bit CAS is all it needs.
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include "ConcurrentVector.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+template <class T>
+class ConcurrentStack {
+private:
+    static constexpr std::uint32_t kNil = 0xffffffffu;
+
+    struct Node {
+        std::atomic<std::uint32_t> next{kNil};
+        alignas(T) unsigned char buf[sizeof(T)];
+        T* get() { return std::launder(reinterpret_cast<T*>(buf)); }
+    };
+
+    // tagged top-of-list word
+    static std::uint32_t indexOf(std::uint64_t top) { return (std::uint32_t)top; }
+    static std::uint64_t retag(std::uint64_t top, std::uint32_t index) {
+        return ((top >> 32) + 1) << 32 | index;
+    }
+
+    ConcurrentVector<Node> nodes_;
+    alignas(64) std::atomic<std::uint64_t> head_{kNil};
+    alignas(64) std::atomic<std::uint64_t> free_{kNil};
+
+    void pushIndex(std::atomic<std::uint64_t>& list, std::uint32_t i) {
+        Node& n = nodes_[i];
+        std::uint64_t top = list.load(std::memory_order_relaxed);
+        do {
+            n.next.store(indexOf(top), std::memory_order_relaxed);
+        } while (!list.compare_exchange_weak(top, retag(top, i), std::memory_order_release,
+                                             std::memory_order_relaxed));
+    }
+
+    // kNil if the list is empty
+    std::uint32_t popIndex(std::atomic<std::uint64_t>& list) {
+        std::uint64_t top = list.load(std::memory_order_acquire);
+        for (;;) {
+            std::uint32_t i = indexOf(top);
+            if (i == kNil) return kNil;
+            // the node may be popped and reused under us; then next is stale
+            // but the tag has moved on and the CAS below fails
+            std::uint32_t next = nodes_[i].next.load(std::memory_order_relaxed);
+            if (list.compare_exchange_weak(top, retag(top, next), std::memory_order_acquire,
+                                           std::memory_order_acquire))
+                return i;
+        }
+    }
+
+    std::uint32_t acquireNode() {
+        std::uint32_t i = popIndex(free_);
+        if (i != kNil) return i;
+        std::size_t fresh = nodes_.emplace_back();
+        if (fresh >= kNil) throw std::length_error("ConcurrentStack full");
+        return (std::uint32_t)fresh;
+    }
+
+public:
+    ConcurrentStack() = default;
+    ConcurrentStack(const ConcurrentStack&) = delete;
+    ConcurrentStack& operator=(const ConcurrentStack&) = delete;
+
+    // no thread may be using the stack while destroying
+    ~ConcurrentStack() {
+        for (std::uint32_t i = indexOf(head_.load(std::memory_order_relaxed)); i != kNil;
+             i = nodes_[i].next.load(std::memory_order_relaxed))
+            nodes_[i].get()->~T();
+    }
+
+    // a snapshot; other threads may change it immediately
+    bool isEmpty() const { return indexOf(head_.load(std::memory_order_acquire)) == kNil; }
+
+    // nodes ever allocated (live items plus the free list)
+    std::size_t nodeCount() const { return nodes_.size(); }
+
+    template <class... Args>
+    void emplace(Args&&... args) {
+        std::uint32_t i = acquireNode();
+        try {
+            ::new (static_cast<void*>(nodes_[i].buf)) T(std::forward<Args>(args)...);
+        } catch (...) {
+            pushIndex(free_, i);
+            throw;
+        }
+        pushIndex(head_, i);
+    }
+    void push(const T& x) { emplace(x); }
+    void push(T&& x) { emplace(std::move(x)); }
+
+    // moves the top into out and pops it; false if empty
+    bool try_pop(T& out) {
+        std::uint32_t i = popIndex(head_);
+        if (i == kNil) return false;
+        T* p = nodes_[i].get();
+        out = std::move(*p);
+        p->~T();
+        pushIndex(free_, i);
+        return true;
+    }
+};
+
+#endif
@@ -0,0 +1,151 @@
+#pragma once
+// ConcurrentVector.h
+// Append-only vector that many threads can push_back into at once.
+//
+// Storage is a list of segments whose sizes double (B, 2B, 4B, ...), so
+// growing never moves an element: references and indices stay valid for
+// the life of the container. push_back claims an index with one atomic
+// fetch_add, installs the segment with a CAS if it is the first one there,
+// constructs the element and publishes it. Reads are plain index math
+// plus a load, no locks and no retries.
+#ifndef CONCURRENT_VECTOR_H
+#define CONCURRENT_VECTOR_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>    // std::this_thread::yield
+#include <utility>
+
+template <class T, std::size_t FirstSegment = 64>
+class ConcurrentVector {
+    static_assert(FirstSegment > 0 && (FirstSegment & (FirstSegment - 1)) == 0,
+                  "FirstSegment must be a power of two");
+
+private:
+    struct Slot {
+        std::atomic<bool> ready{false};              // set once the element is constructed
+        alignas(T) unsigned char buf[sizeof(T)];
+        T* get() { return std::launder(reinterpret_cast<T*>(buf)); }
+    };
+
+    static constexpr std::size_t log2(std::size_t x) {
+        std::size_t r = 0;
+        while (x >>= 1) ++r;
+        return r;
+    }
+    static constexpr std::size_t kFirstLog = log2(FirstSegment);
+    static constexpr std::size_t kMaxSegments = sizeof(std::size_t) * 8 - kFirstLog;
+
+    std::atomic<Slot*> segments_[kMaxSegments] = {};
+    std::atomic<std::size_t> claimed_{0};
+
+    // segment k holds indices [B(2^k - 1), B(2^(k+1) - 1))
+    static std::size_t segmentOf(std::size_t i) {
+        std::size_t j = i + FirstSegment;
+#if defined(__GNUC__)
+        return (std::size_t)(sizeof(unsigned long long) * 8 - 1 - __builtin_clzll(j)) - kFirstLog;
+#else
+        return log2(j) - kFirstLog;
+#endif
+    }
+    static std::size_t segmentSize(std::size_t k) { return FirstSegment << k; }
+    static std::size_t segmentStart(std::size_t k) { return FirstSegment * ((std::size_t(1) << k) - 1); }
+
+    // Install segment k if nobody has yet. Segments are normally allocated
+    // ahead of time (see emplace_back), so a thread that finds one missing
+    // yields a few times for the allocator to finish before racing it with
+    // its own allocation; CAS losers free theirs. No thread ever has to
+    // wait on another, it just may waste an allocation.
+    Slot* segment(std::size_t k) {
+        Slot* s = segments_[k].load(std::memory_order_acquire);
+        for (int spin = 0; !s && spin < 64; ++spin) {
+            std::this_thread::yield();
+            s = segments_[k].load(std::memory_order_acquire);
+        }
+        if (s) return s;
+        return install(k);
+    }
+    Slot* install(std::size_t k) {
+        Slot* s = nullptr;
+        Slot* fresh = new Slot[segmentSize(k)];
+        if (segments_[k].compare_exchange_strong(s, fresh, std::memory_order_acq_rel,
+                                                 std::memory_order_acquire))
+            return fresh;
+        delete[] fresh;
+        return s;
+    }
+
+    Slot& slot(std::size_t i) const {
+        std::size_t k = segmentOf(i);
+        return segments_[k].load(std::memory_order_acquire)[i - segmentStart(k)];
+    }
+
+public:
+    ConcurrentVector() = default;
+    ConcurrentVector(const ConcurrentVector&) = delete;
+    ConcurrentVector& operator=(const ConcurrentVector&) = delete;
+
+    // no concurrent pushes may be in flight while destroying
+    ~ConcurrentVector() {
+        std::size_t n = claimed_.load(std::memory_order_relaxed);
+        for (std::size_t k = 0; k < kMaxSegments; ++k) {
+            Slot* s = segments_[k].load(std::memory_order_relaxed);
+            if (!s) continue;
+            std::size_t start = segmentStart(k);
+            for (std::size_t j = 0; j < segmentSize(k) && start + j < n; ++j)
+                if (s[j].ready.load(std::memory_order_relaxed)) s[j].get()->~T();
+            delete[] s;
+        }
+    }
+
+    // number of indices handed out so far; an index below this may still be
+    // under construction by another thread (see isReady)
+    std::size_t size() const { return claimed_.load(std::memory_order_acquire); }
+    bool empty() const { return size() == 0; }
+
+    // lock-free append; returns the new element's index
+    template <class... Args>
+    std::size_t emplace_back(Args&&... args) {
+        std::size_t i = claimed_.fetch_add(1, std::memory_order_relaxed);
+        std::size_t k = segmentOf(i);
+        std::size_t off = i - segmentStart(k);
+        Slot* seg = segments_[k].load(std::memory_order_acquire);
+        if (!seg) seg = (off == 0) ? install(k) : segment(k);
+        // halfway through segment k, whoever lands there allocates k+1
+        if (off == segmentSize(k) / 2 && k + 1 < kMaxSegments &&
+            !segments_[k + 1].load(std::memory_order_relaxed))
+            install(k + 1);
+        Slot& s = seg[off];
+        ::new (static_cast<void*>(s.buf)) T(std::forward<Args>(args)...);
+        s.ready.store(true, std::memory_order_release);
+        return i;
+    }
+    std::size_t push_back(const T& x) { return emplace_back(x); }
+    std::size_t push_back(T&& x) { return emplace_back(std::move(x)); }
+
+    // true once element i has been published (acquire: its contents are visible)
+    bool isReady(std::size_t i) const {
+        if (i >= size()) return false;
+        std::size_t k = segmentOf(i);
+        Slot* s = segments_[k].load(std::memory_order_acquire);
+        return s && s[i - segmentStart(k)].ready.load(std::memory_order_acquire);
+    }
+
+    // wait-free reads. operator[] is unchecked: i must come from push_back
+    // on this thread or from a successful isReady(i).
+    T& operator[](std::size_t i) { return *slot(i).get(); }
+    const T& operator[](std::size_t i) const { return *slot(i).get(); }
+
+    T& at(std::size_t i) {
+        if (!isReady(i)) throw std::out_of_range("at");
+        return *slot(i).get();
+    }
+    const T& at(std::size_t i) const {
+        if (!isReady(i)) throw std::out_of_range("at");
+        return *slot(i).get();
+    }
+};
+
+#endif
@@ -3,61 +3,359 @@
 #include <vector>
 #include <string>
 #include <cassert>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include "FenwickTree.h"
 
-template <typename T>
+// Entries live in chunks of up to kChunk slots, kept in list order in the
+// middle of a directory so new chunks can be opened at either end in O(1)
+// amortized. Each chunk knows how many of its entries are live (not marked
+// deleted), and a Fenwick tree over the directory holds those counts, so
+// at(i) finds the chunk holding the i-th visible item in O(log n) and then
+// scans one chunk. Pushes (and deletes) in the two end chunks bump a
+// pending count instead of the tree, so push_front/push_back stay O(1);
+// the counts are folded in when a new end chunk opens. at() reads the end
+// chunks' own counts, so it never writes and const reads can be shared.
+//
+// Tombstones are reclaimed incrementally. Once hidden >= threshold * active
+// a compaction pass starts, and each later push or mark-delete advances it
+// by about `budget` slots, a chunk at a time: the chunk's tombstones are
+// destroyed, it folds into the chunk before it if both fit, and survivors
+// slide down the directory over the chunks that went. No single call pays
+// for the whole list. compaction_stats() reports what the passes cost.
+//
+// With Indexed = true the list also keeps a hash map from each value to
+// the first and last of its live copies, which are threaded together in
+// list order by prev/next links kept beside each slot. contains and
+// mark_delete_first are O(1) expected and mark_delete_all is O(matches).
+// The index costs two words per slot plus one small map node per distinct
+// value; compaction moving an entry repoints its neighbours in O(1).
+template <typename T, bool Indexed = false, class Hash = std::hash<T>>
 class LazyList {
 private:
-    struct Node {
-        T data;
-        bool deleted;
-        Node* next;
-        Node(const T& value, Node* nxt = nullptr)
-            : data(value), deleted(false), next(nxt) {
+    static constexpr std::size_t kChunk = 64;
+
+    struct Chunk;
+    // A live, indexed entry: its chunk's address with the slot in the low
+    // bits (chunks are kChunk-aligned). 0 means none.
+    using Ref = std::uintptr_t;
+    static Ref ref_to(Chunk* c, std::size_t i) { return reinterpret_cast<Ref>(c) | i; }
+    static Chunk* chunk_of(Ref r) { return reinterpret_cast<Chunk*>(r & ~(Ref)(kChunk - 1)); }
+    static std::size_t slot_of(Ref r) { return (std::size_t)(r & (kChunk - 1)); }
+
+    struct NoLinks {};
+    struct SlotLinks {
+        Ref prev[kChunk];   // neighbouring live copies of the same value
+        Ref next[kChunk];
+    };
+    struct Ends {
+        Ref first, last;
+    };
+    struct NoIndex {};
+    using Index = typename std::conditional<Indexed, std::unordered_map<T, Ends, Hash>, NoIndex>::type;
+
+    // entries in slots [begin, end); push_back fills upward, push_front downward
+    struct alignas(kChunk) Chunk : std::conditional<Indexed, SlotLinks, NoLinks>::type {
+        std::size_t begin, end;
+        std::size_t live;          // entries in [begin, end) not marked deleted
+        std::size_t pos;           // where it sits in dir
+        bool deleted[kChunk];
+        alignas(T) unsigned char buf[kChunk * sizeof(T)];
+
+        Chunk(std::size_t at, std::size_t where) : begin(at), end(at), live(0), pos(where) {}
+        ~Chunk() { for (std::size_t i = begin; i < end; ++i) slot(i).~T(); }
+
+        void* raw(std::size_t i) { return buf + i * sizeof(T); }
+        T& slot(std::size_t i) { return *std::launder(reinterpret_cast<T*>(raw(i))); }
+        const T& slot(std::size_t i) const {
+            return *std::launder(reinterpret_cast<const T*>(buf + i * sizeof(T)));
         }
     };
 
-    Node* head;
+    std::vector<Chunk*> dir;    // the chunks, in order, are dir[lo, hi)
+    std::size_t lo;
+    std::size_t hi;
+    FenwickTree<long long> live_in;        // live entries of dir[d] at position d + 1
+    long long front_pending, back_pending; // changes to dir[lo] / dir[hi - 1] not yet in live_in
     std::size_t active_count;   // visible items
     std::size_t deleted_count;  // hidden (marked) items
 
+public:
+    struct CompactionStats {
+        std::size_t reclaimed = 0;             // tombstones destroyed
+        std::size_t passes = 0;                // passes started
+        std::chrono::nanoseconds max_pause{0}; // longest time one call spent compacting
+    };
+
+private:
+    // During a pass, dir[sweep, hi) is still to visit and the chunks already
+    // visited sit packed in dir[lo, packed); dir[packed, sweep) is empty.
+    double threshold;
+    std::size_t budget;
+    bool compacting;
+    std::size_t sweep, packed;
+    CompactionStats stats;
+
+    Index index;
+
+    void flush() {
+        if (front_pending) { live_in.add(lo + 1, front_pending); front_pending = 0; }
+        if (back_pending) { live_in.add(hi, back_pending); back_pending = 0; }
+    }
+
+    // put chunks in the middle of a fresh directory with room on both
+    // sides and rebuild live_in from their counts
+    void layout(const std::vector<Chunk*>& chunks) {
+        std::size_t cap = std::max<std::size_t>(8, chunks.size() * 4);
+        std::vector<Chunk*> fresh(cap, nullptr);
+        lo = (cap - chunks.size()) / 2;
+        hi = lo + chunks.size();
+        std::copy(chunks.begin(), chunks.end(), fresh.begin() + lo);
+        dir.swap(fresh);
+        FenwickTree<long long> counts(cap);
+        for (std::size_t d = lo; d < hi; ++d) {
+            dir[d]->pos = d;
+            counts.add(d + 1, (long long)dir[d]->live);
+        }
+        live_in = std::move(counts);
+        front_pending = back_pending = 0;
+        compacting = false;   // positions moved; the next mutating call restarts it
+    }
+    std::vector<Chunk*> chunk_list() const {
+        std::vector<Chunk*> chunks;
+        for (std::size_t d = lo; d < hi; ++d)
+            if (dir[d]) chunks.push_back(dir[d]);
+        return chunks;
+    }
+
+    // chunk with a free slot at the back / front, opening one if needed
+    // (dir[hi - 1] always holds a chunk; mid-pass, dir[lo] may not)
+    Chunk* back_chunk() {
+        if (lo == hi || dir[hi - 1]->end == kChunk) {
+            if (hi == dir.size()) layout(chunk_list());
+            flush();
+            dir[hi] = new Chunk(0, hi);
+            ++hi;
+        }
+        return dir[hi - 1];
+    }
+    Chunk* front_chunk() {
+        if (lo == hi || !dir[lo] || dir[lo]->begin == 0) {
+            if (lo == 0) layout(chunk_list());
+            flush();
+            --lo;
+            dir[lo] = new Chunk(kChunk, lo);
+        }
+        return dir[lo];
+    }
+
+    void hide(std::size_t d, std::size_t i) {
+        Chunk* c = dir[d];
+        c->deleted[i] = true;
+        --c->live;
+        // the end chunks' live_in counts are left as they were at the last
+        // flush, so every count there stays >= 0 and findKth stays valid
+        if (d == lo) --front_pending;
+        else if (d + 1 == hi) --back_pending;
+        else live_in.add(d + 1, -1);
+        --active_count; ++deleted_count;
+    }
+
+    // the live entry now at (c, i) came from (from, j): repoint its
+    // neighbours, or its map entry where it is the first or last copy
+    void moved(Chunk& c, std::size_t i, Chunk& from, std::size_t j) {
+        if constexpr (Indexed) {
+            Ref self = ref_to(&c, i);
+            Ref prev = from.prev[j], next = from.next[j];
+            c.prev[i] = prev;
+            c.next[i] = next;
+            if (prev) chunk_of(prev)->next[slot_of(prev)] = self;
+            if (next) chunk_of(next)->prev[slot_of(next)] = self;
+            if (!prev || !next) {
+                Ends& e = index.find(c.slot(i))->second;
+                if (!prev) e.first = self;
+                if (!next) e.last = self;
+            }
+        }
+    }
+
+    // Destroy c's tombstones and pack its live entries down from slot 0.
+    // Its live count, and so live_in, doesn't change. Returns how many
+    // tombstones went.
+    std::size_t squeeze(Chunk& c) {
+        std::size_t w = 0;
+        for (std::size_t r = c.begin; r < c.end; ++r) {
+            if (c.deleted[r]) { c.slot(r).~T(); continue; }
+            if (w != r) {
+                ::new (c.raw(w)) T(std::move(c.slot(r)));
+                c.slot(r).~T();
+                c.deleted[w] = false;
+                moved(c, w, c, r);
+            }
+            ++w;
+        }
+        std::size_t dropped = (c.end - c.begin) - w;
+        c.begin = 0;
+        c.end = w;
+        return dropped;
+    }
+
+    // move the entries of src (squeezed) onto the end of dst
+    void append(Chunk& dst, Chunk& src) {
+        for (std::size_t r = src.begin; r < src.end; ++r) {
+            ::new (dst.raw(dst.end)) T(std::move(src.slot(r)));
+            dst.deleted[dst.end] = false;
+            moved(dst, dst.end++, src, r);
+        }
+        dst.live += src.live;
+    }
+
+    // move dir[from] to dir[to], keeping live_in in step
+    void relocate(std::size_t from, std::size_t to) {
+        long long n = (long long)dir[from]->live;
+        live_in.add(from + 1, -n);
+        live_in.add(to + 1, n);
+        dir[to] = dir[from];
+        dir[to]->pos = to;
+        dir[from] = nullptr;
+    }
+
+    // advance the pass until about `limit` slots have been scanned
+    void compact_step(std::size_t limit) {
+        flush();
+        std::size_t work = 0;
+        while (sweep < hi && work < limit) {
+            std::size_t d = sweep++;
+            Chunk* c = dir[d];
+            work += c->end - c->begin + 1;
+            std::size_t dropped = squeeze(*c);
+            deleted_count -= dropped;
+            stats.reclaimed += dropped;
+
+            Chunk* prev = packed > lo ? dir[packed - 1] : nullptr;
+            if (prev && prev->end + c->end <= kChunk) {
+                live_in.add(packed, (long long)c->live);
+                live_in.add(d + 1, -(long long)c->live);
+                append(*prev, *c);
+                delete c;
+                dir[d] = nullptr;
+            }
+            else if (c->end == 0) {
+                delete c;
+                dir[d] = nullptr;
+            }
+            else {
+                if (packed != d) relocate(d, packed);
+                ++packed;
+            }
+        }
+        while (lo < sweep && !dir[lo]) ++lo;
+        if (packed < lo) packed = lo;
+        if (sweep == hi) {
+            hi = packed;
+            compacting = false;
+        }
+    }
+
+    void run_compaction(std::size_t limit) {
+        auto t0 = std::chrono::steady_clock::now();
+        compact_step(limit);
+        auto pause = std::chrono::steady_clock::now() - t0;
+        if (pause > stats.max_pause) stats.max_pause = std::chrono::duration_cast<std::chrono::nanoseconds>(pause);
+    }
+
+    bool over_threshold() const {
+        return deleted_count > 0 && (double)deleted_count >= threshold * (double)active_count;
+    }
+    void start_pass() {
+        compacting = true;
+        sweep = packed = lo;
+        ++stats.passes;
+    }
+
     void compact_if_needed() {
-        if (deleted_count == active_count && deleted_count > 0) {
-            Node* prev = nullptr;
-            Node* cur = head;
-            while (cur) {
-                if (cur->deleted) {
-                    Node* to_delete = cur;
-                    cur = cur->next;
-                    if (prev) prev->next = cur;
-                    else head = cur;
-                    delete to_delete;
-                    --deleted_count;
-                }
-                else {
-                    prev = cur;
-                    cur = cur->next;
+        if (!compacting) {
+            if (!over_threshold()) return;
+            start_pass();
+        }
+        run_compaction(budget);
+    }
+
+    // record the new live entry at (c, i) as the last / first copy of its
+    // value; only the map insert can throw, and it comes first
+    void index_back(Chunk& c, std::size_t i) {
+        if constexpr (Indexed) {
+            Ref self = ref_to(&c, i);
+            Ends& e = index.try_emplace(c.slot(i), Ends{0, 0}).first->second;
+            c.prev[i] = e.last;
+            c.next[i] = 0;
+            if (e.last) chunk_of(e.last)->next[slot_of(e.last)] = self;
+            else e.first = self;
+            e.last = self;
+        }
+    }
+    void index_front(Chunk& c, std::size_t i) {
+        if constexpr (Indexed) {
+            Ref self = ref_to(&c, i);
+            Ends& e = index.try_emplace(c.slot(i), Ends{0, 0}).first->second;
+            c.prev[i] = 0;
+            c.next[i] = e.first;
+            if (e.first) chunk_of(e.first)->prev[slot_of(e.first)] = self;
+            else e.last = self;
+            e.first = self;
+        }
+    }
+
+    void copy_from(const LazyList& other) {
+        std::vector<Chunk*> chunks;
+        try {
+            for (std::size_t d = other.lo; d < other.hi; ++d) {
+                if (!other.dir[d]) continue;
+                const Chunk& c = *other.dir[d];
+                chunks.push_back(new Chunk(c.begin, 0));
+                Chunk& n = *chunks.back();
+                for (std::size_t i = c.begin; i < c.end; ++i) {
+                    ::new (n.raw(i)) T(c.slot(i));
+                    n.deleted[n.end++] = c.deleted[i];
+                    if (!c.deleted[i]) index_back(n, i);
                 }
+                n.live = c.live;
             }
         }
+        catch (...) {
+            if constexpr (Indexed) index.clear();
+            for (Chunk* c : chunks) delete c;
+            throw;
+        }
+        layout(chunks);
+        threshold = other.threshold;
+        budget = other.budget;
+        active_count = other.active_count;
+        deleted_count = other.deleted_count;
     }
 
-    void copy_from(const LazyList& other) {
-        head = nullptr;
-        active_count = 0;
-        deleted_count = 0;
-        Node* tail = nullptr;
-        for (Node* cur = other.head; cur; cur = cur->next) {
-            Node* n = new Node(cur->data);
-            n->deleted = cur->deleted;
-            if (!head) { head = tail = n; }
-            else { tail->next = n; tail = n; }
-            if (n->deleted) ++deleted_count; else ++active_count;
+    // f(chunk, slot) for every entry, hidden ones included, in list order
+    template <class F>
+    void for_each_entry(F f) const {
+        for (std::size_t d = lo; d < hi; ++d) {
+            if (!dir[d]) continue;
+            const Chunk& c = *dir[d];
+            for (std::size_t i = c.begin; i < c.end; ++i) f(c, i);
         }
     }
 
 public:
-    LazyList() : head(nullptr), active_count(0), deleted_count(0) {}
-    LazyList(const LazyList& rhs) : head(nullptr), active_count(0), deleted_count(0) { copy_from(rhs); }
+    LazyList()
+        : lo(0), hi(0), live_in(0), front_pending(0), back_pending(0), active_count(0), deleted_count(0),
+          threshold(1.0), budget(256), compacting(false), sweep(0), packed(0) {
+    }
+    LazyList(const LazyList& rhs) : LazyList() { copy_from(rhs); }
     LazyList& operator=(const LazyList& rhs) {
         if (this != &rhs) { clear(); copy_from(rhs); }
         return *this;
@@ -65,95 +363,183 @@ public:
     ~LazyList() { clear(); }
 
     void clear() {
-        Node* cur = head;
-        while (cur) { Node* nxt = cur->next; delete cur; cur = nxt; }
-        head = nullptr; active_count = 0; deleted_count = 0;
+        for (std::size_t d = lo; d < hi; ++d) delete dir[d];
+        dir.clear();
+        lo = hi = 0;
+        live_in = FenwickTree<long long>(0);
+        front_pending = back_pending = 0;
+        active_count = 0; deleted_count = 0;
+        compacting = false;
+        if constexpr (Indexed) index.clear();
     }
 
     void push_front(const T& value) {
-        head = new Node(value, head);
+        Chunk* c = front_chunk();
+        std::size_t i = c->begin - 1;
+        ::new (c->raw(i)) T(value);
+        try { index_front(*c, i); }
+        catch (...) { c->slot(i).~T(); throw; }
+        c->deleted[--c->begin] = false;
+        ++c->live; ++front_pending;
         ++active_count;
         compact_if_needed();
     }
 
     void push_back(const T& value) {
-        Node* n = new Node(value);
-        if (!head) head = n;
-        else {
-            Node* cur = head;
-            while (cur->next) cur = cur->next;
-            cur->next = n;
-        }
+        Chunk* c = back_chunk();
+        std::size_t i = c->end;
+        ::new (c->raw(i)) T(value);
+        try { index_back(*c, i); }
+        catch (...) { c->slot(i).~T(); throw; }
+        c->deleted[c->end++] = false;
+        ++c->live; ++back_pending;
         ++active_count;
         compact_if_needed();
     }
 
     // Mark-delete first visible occurrence
     bool mark_delete_first(const T& value) {
-        for (Node* cur = head; cur; cur = cur->next) {
-            if (!cur->deleted && cur->data == value) {
-                cur->deleted = true;
-                --active_count; ++deleted_count;
-                compact_if_needed();
-                return true;
+        if constexpr (Indexed) {
+            auto it = index.find(value);
+            if (it == index.end()) return false;
+            Ref first = it->second.first;
+            Chunk* c = chunk_of(first);
+            Ref next = c->next[slot_of(first)];
+            if (next) {
+                chunk_of(next)->prev[slot_of(next)] = 0;
+                it->second.first = next;
             }
+            else index.erase(it);
+            hide(c->pos, slot_of(first));
+            compact_if_needed();
+            return true;
+        }
+        else {
+            for (std::size_t d = lo; d < hi; ++d) {
+                if (!dir[d]) continue;
+                const Chunk& c = *dir[d];
+                for (std::size_t i = c.begin; i < c.end; ++i) {
+                    if (!c.deleted[i] && c.slot(i) == value) {
+                        hide(d, i);
+                        compact_if_needed();
+                        return true;
+                    }
+                }
+            }
+            return false;
         }
-        return false;
     }
 
     // Mark-delete all visible matches
     std::size_t mark_delete_all(const T& value) {
         std::size_t removed = 0;
-        for (Node* cur = head; cur; cur = cur->next) {
-            if (!cur->deleted && cur->data == value) {
-                cur->deleted = true;
-                --active_count; ++deleted_count; ++removed;
+        if constexpr (Indexed) {
+            auto it = index.find(value);
+            if (it != index.end()) {
+                for (Ref r = it->second.first; r; ) {
+                    Chunk* c = chunk_of(r);
+                    std::size_t i = slot_of(r);
+                    r = c->next[i];
+                    hide(c->pos, i);
+                    ++removed;
+                }
+                index.erase(it);
+            }
+        }
+        else {
+            for (std::size_t d = lo; d < hi; ++d) {
+                if (!dir[d]) continue;
+                const Chunk& c = *dir[d];
+                for (std::size_t i = c.begin; i < c.end; ++i) {
+                    if (!c.deleted[i] && c.slot(i) == value) {
+                        hide(d, i);
+                        ++removed;
+                    }
+                }
             }
         }
         compact_if_needed();
         return removed;
     }
 
+    // Start a pass once hidden >= threshold_ * active (1.0 reclaims when
+    // half the entries are tombstones); each mutating call then scans about
+    // budget_ slots of it, rounded up to a whole chunk.
+    void set_compaction(double threshold_, std::size_t budget_) {
+        if (!(threshold_ >= 0)) throw std::invalid_argument("compaction threshold must be >= 0");
+        if (budget_ == 0) throw std::invalid_argument("compaction budget must be positive");
+        threshold = threshold_;
+        budget = budget_;
+    }
+    // reclaim every tombstone now, in one long pause
+    void compact() {
+        if (compacting) run_compaction((std::size_t)-1);
+        if (deleted_count > 0) {
+            start_pass();
+            run_compaction((std::size_t)-1);
+        }
+    }
+    const CompactionStats& compaction_stats() const { return stats; }
+    void reset_compaction_stats() { stats = CompactionStats(); }
+
     // Queries ignoring deleted
     std::size_t size() const { return active_count; }
     std::size_t hidden_count() const { return deleted_count; }
     bool empty() const { return active_count == 0; }
 
     bool contains(const T& value) const {
-        for (Node* cur = head; cur; cur = cur->next)
-            if (!cur->deleted && cur->data == value) return true;
+        if constexpr (Indexed) return index.find(value) != index.end();
+        for (std::size_t d = lo; d < hi; ++d) {
+            if (!dir[d]) continue;
+            const Chunk& c = *dir[d];
+            for (std::size_t i = c.begin; i < c.end; ++i)
+                if (!c.deleted[i] && c.slot(i) == value) return true;
+        }
         return false;
     }
 
     // Get i-th visible element (0-based). Returns false if out of range.
+    // O(log n): the end chunks are checked by their own counts, live_in
+    // finds anything between them, then one chunk is scanned.
     bool at(std::size_t index, T& out) const {
-        std::size_t i = 0;
-        for (Node* cur = head; cur; cur = cur->next) {
-            if (!cur->deleted) {
-                if (i == index) { out = cur->data; return true; }
-                ++i;
-            }
+        if (index >= active_count) return false;
+        std::size_t k = index + 1;   // rank among the live entries
+        const Chunk* c = dir[hi - 1];
+        std::size_t before_last = active_count - c->live;
+        std::size_t front = dir[lo] ? dir[lo]->live : 0;
+        if (k > before_last) k -= before_last;
+        else if (k <= front) c = dir[lo];
+        else {
+            // between the ends live_in is exact, except that dir[lo]'s
+            // count there is short by front_pending
+            long long want = (long long)k - front_pending;
+            std::size_t pos = live_in.findKth(want);
+            k -= (std::size_t)(live_in.prefixSum(pos - 1) + front_pending);
+            c = dir[pos - 1];
+        }
+        for (std::size_t i = c->begin;; ++i) {
+            if (!c->deleted[i] && --k == 0) { out = c->slot(i); return true; }
         }
-        return false;
     }
 
     std::vector<T> to_vector() const {
         std::vector<T> v;
         v.reserve(active_count);
-        for (Node* cur = head; cur; cur = cur->next)
-            if (!cur->deleted) v.push_back(cur->data);
+        for_each_entry([&](const Chunk& c, std::size_t i) {
+            if (!c.deleted[i]) v.push_back(c.slot(i));
+        });
         return v;
     }
 
     void print() const {
         std::cout << "[";
         bool first = true;
-        for (Node* cur = head; cur; cur = cur->next) {
-            if (!cur->deleted) {
+        for_each_entry([&](const Chunk& c, std::size_t i) {
+            if (!c.deleted[i]) {
                 if (!first) std::cout << ", ";
-                std::cout << cur->data; first = false;
+                std::cout << c.slot(i); first = false;
             }
-        }
+        });
         std::cout << "] (active=" << active_count << ", hidden=" << deleted_count << ")\n";
     }
 };
@@ -181,6 +567,48 @@ int main() {
     copy.print();
     lst.print();
 
+    // Indexed reads over a big list with tombstones: each at() is O(log n)
+    LazyList<int> big;
+    const int n = 100000;
+    for (int i = 0; i < n; ++i) big.push_back(i % 1000);
+    for (int v = 0; v < 300; ++v) big.mark_delete_all(v);
+    std::vector<int> expect = big.to_vector();
+    auto t0 = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < big.size(); ++i) {
+        ok = big.at(i, x);
+        assert(ok && x == expect[i]);
+    }
+    std::cout << "at(0.." << big.size() << ") ms="
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+              << " (hidden=" << big.hidden_count() << ")\n";
+
+    // Deleting most of it starts a compaction pass; the pushes after it each
+    // reclaim one budget's worth, so no single call stalls for the whole list.
+    for (int v = 300; v < 900; ++v) big.mark_delete_all(v);
+    for (int i = 0; i < 1000; ++i) big.push_back(-1);
+    const auto& st = big.compaction_stats();
+    std::cout << "compaction: reclaimed=" << st.reclaimed << " passes=" << st.passes
+              << " max pause us=" << st.max_pause.count() / 1000.0
+              << " (hidden=" << big.hidden_count() << ")\n";
+
+    // Membership tests and deletes by value: a scan each without the index,
+    // a hash lookup each with it
+    LazyList<int> plain;
+    LazyList<int, true> indexed;
+    for (int i = 0; i < 20000; ++i) { plain.push_back(i); indexed.push_back(i); }
+    for (int pass = 0; pass < 2; ++pass) {
+        t0 = std::chrono::steady_clock::now();
+        std::size_t hits = 0;
+        for (int v = 0; v < 20000; v += 2) {
+            if (pass == 0) { hits += plain.contains(v); plain.mark_delete_first(v); }
+            else { hits += indexed.contains(v); indexed.mark_delete_first(v); }
+        }
+        std::cout << (pass == 0 ? "scan " : "index") << " contains+mark_delete_first x10000 ms="
+                  << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - t0).count()
+                  << " (" << hits << ")\n";
+    }
+    assert(plain.to_vector() == indexed.to_vector());
+
     std::cout << "Done.\n";
     return 0;
 }
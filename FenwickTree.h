@@ -0,0 +1,59 @@
+#pragma once
+// FenwickTree.h
+// Binary indexed tree over positions 1..n: point add and prefix sum in
+// O(log n). With non-negative counts it doubles as an order-statistic set:
+// findKth(k) returns the position holding the k-th unit, also O(log n).
+#ifndef FENWICK_TREE_H
+#define FENWICK_TREE_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+template <class T = long long>
+class FenwickTree {
+private:
+    std::vector<T> tree;   // tree[i] covers (i - lowbit(i), i]
+    std::size_t n;
+    std::size_t topBit;    // highest power of two <= n
+
+public:
+    // every position starts at initial; O(n)
+    explicit FenwickTree(std::size_t size, const T& initial = T())
+        : tree(size + 1), n(size), topBit(1) {
+        while (topBit * 2 <= n) topBit *= 2;
+        if (initial != T())
+            for (std::size_t i = 1; i <= n; ++i) tree[i] = initial * (T)(i & (~i + 1));
+    }
+
+    std::size_t size() const { return n; }
+
+    void add(std::size_t pos, const T& delta) {
+        if (pos < 1 || pos > n) throw std::out_of_range("FenwickTree::add");
+        for (; pos <= n; pos += pos & (~pos + 1)) tree[pos] += delta;
+    }
+
+    // sum of positions 1..pos
+    T prefixSum(std::size_t pos) const {
+        if (pos > n) pos = n;
+        T s = T();
+        for (; pos > 0; pos -= pos & (~pos + 1)) s += tree[pos];
+        return s;
+    }
+
+    // smallest pos with prefixSum(pos) >= k (k >= 1, counts non-negative);
+    // n + 1 if the total is below k
+    std::size_t findKth(T k) const {
+        std::size_t pos = 0;
+        for (std::size_t step = n ? topBit : 0; step; step >>= 1) {
+            std::size_t next = pos + step;
+            if (next <= n && tree[next] < k) {
+                pos = next;
+                k -= tree[next];
+            }
+        }
+        return pos + 1;
+    }
+};
+
+#endif
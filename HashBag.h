@@ -0,0 +1,240 @@
+#pragma once
+// HashBag.h
+// Bag (multiset) stored as (item, count) pairs in an open-addressing hash
+// table: linear probing, power-of-two capacity, at most 3/4 full. Equal
+// items share one slot, so add/remove/contains/getFrequencyOf are O(1)
+// expected no matter how many copies are in the bag. A slot whose count
+// drops to zero is emptied with backward-shift deletion, so there are no
+// tombstones and probe runs stay short.
+//
+// Same interface as Bag.h, plus add(item, n), addAll, merge, and iteration
+// over the distinct items as (item, count) pairs (in no particular order).
+#ifndef HASH_BAG_H
+#define HASH_BAG_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+template <class T, class Hash = std::hash<T>, class Eq = std::equal_to<T>>
+class HashBag {
+private:
+    struct Slot {
+        std::size_t count;   // 0 = empty
+        std::size_t hash;
+        alignas(T) unsigned char buf[sizeof(T)];
+        T& item() { return *std::launder(reinterpret_cast<T*>(buf)); }
+        const T& item() const { return *std::launder(reinterpret_cast<const T*>(buf)); }
+    };
+
+    Slot* slots_ = nullptr;
+    std::size_t cap_ = 0;        // 0 or a power of two
+    std::size_t distinct_ = 0;   // occupied slots
+    std::size_t total_ = 0;      // sum of counts
+    Hash hasher_;
+    Eq eq_;
+
+    std::size_t mask() const { return cap_ - 1; }
+
+    // slot holding item, or the empty slot where it would go (cap_ > 0)
+    std::size_t probe(const T& item, std::size_t h) const {
+        std::size_t i = h & mask();
+        while (slots_[i].count && !(slots_[i].hash == h && eq_(slots_[i].item(), item)))
+            i = (i + 1) & mask();
+        return i;
+    }
+    // occupied slot for item, or cap_ if absent
+    std::size_t find(const T& item) const {
+        if (distinct_ == 0) return cap_;
+        std::size_t i = probe(item, hasher_(item));
+        return slots_[i].count ? i : cap_;
+    }
+
+    void destroyAll() {
+        for (std::size_t i = 0; i < cap_; ++i)
+            if (slots_[i].count) slots_[i].item().~T();
+    }
+    void release() {
+        destroyAll();
+        delete[] slots_;
+        slots_ = nullptr;
+        cap_ = distinct_ = total_ = 0;
+    }
+
+    // move every entry into a fresh table of newCap slots
+    void rehash(std::size_t newCap) {
+        Slot* fresh = new Slot[newCap]();
+        std::size_t m = newCap - 1;
+        std::size_t i = 0;
+        try {
+            for (; i < cap_; ++i) {
+                Slot& s = slots_[i];
+                if (!s.count) continue;
+                std::size_t j = s.hash & m;
+                while (fresh[j].count) j = (j + 1) & m;
+                ::new (static_cast<void*>(fresh[j].buf)) T(std::move_if_noexcept(s.item()));
+                fresh[j].count = s.count;
+                fresh[j].hash = s.hash;
+            }
+        } catch (...) {
+            for (std::size_t j = 0; j < newCap; ++j)
+                if (fresh[j].count) fresh[j].item().~T();
+            delete[] fresh;
+            throw;
+        }
+        destroyAll();
+        delete[] slots_;
+        slots_ = fresh;
+        cap_ = newCap;
+    }
+
+    void reserveDistinct(std::size_t n) {
+        if (n * 4 <= cap_ * 3) return;
+        std::size_t c = cap_ ? cap_ : 16;
+        while (n * 4 > c * 3) c *= 2;
+        rehash(c);
+    }
+
+    // empty slot i, pulling later entries of its probe run back one step
+    void erase(std::size_t i) {
+        slots_[i].item().~T();
+        slots_[i].count = 0;
+        --distinct_;
+        std::size_t hole = i;
+        for (std::size_t k = (i + 1) & mask(); slots_[k].count; k = (k + 1) & mask()) {
+            std::size_t home = slots_[k].hash & mask();
+            // k can move into the hole only if the hole lies on its probe path
+            if (((k - home) & mask()) < ((k - hole) & mask())) continue;
+            ::new (static_cast<void*>(slots_[hole].buf)) T(std::move(slots_[k].item()));
+            slots_[hole].count = slots_[k].count;
+            slots_[hole].hash = slots_[k].hash;
+            slots_[k].item().~T();
+            slots_[k].count = 0;
+            hole = k;
+        }
+    }
+
+    class Iter {
+    private:
+        friend class HashBag;
+        const Slot* cur = nullptr;
+        const Slot* end = nullptr;
+        Iter(const Slot* c, const Slot* e) : cur(c), end(e) { skip(); }
+        void skip() { while (cur != end && !cur->count) ++cur; }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::pair<const T&, std::size_t>;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = value_type;
+        using pointer           = void;
+
+        Iter() = default;
+        value_type operator*() const { return value_type(cur->item(), cur->count); }
+        Iter& operator++() { ++cur; skip(); return *this; }
+        Iter operator++(int) { Iter t = *this; ++*this; return t; }
+        friend bool operator==(const Iter& a, const Iter& b) { return a.cur == b.cur; }
+        friend bool operator!=(const Iter& a, const Iter& b) { return a.cur != b.cur; }
+    };
+
+public:
+    using const_iterator = Iter;   // counts are read-only; change them through add/remove
+
+    HashBag() = default;
+    HashBag(std::initializer_list<T> il) { addAll(il); }
+    ~HashBag() { release(); }
+
+    HashBag(const HashBag& rhs) : hasher_(rhs.hasher_), eq_(rhs.eq_) { merge(rhs); }
+    HashBag& operator=(const HashBag& rhs) {
+        if (this != &rhs) { HashBag tmp(rhs); swap(tmp); }
+        return *this;
+    }
+    HashBag(HashBag&& rhs) noexcept { swap(rhs); }
+    HashBag& operator=(HashBag&& rhs) noexcept {
+        if (this != &rhs) { HashBag tmp(std::move(rhs)); swap(tmp); }
+        return *this;
+    }
+    void swap(HashBag& o) noexcept {
+        std::swap(slots_, o.slots_);
+        std::swap(cap_, o.cap_);
+        std::swap(distinct_, o.distinct_);
+        std::swap(total_, o.total_);
+        std::swap(hasher_, o.hasher_);
+        std::swap(eq_, o.eq_);
+    }
+
+    bool        isEmpty() const { return total_ == 0; }
+    std::size_t getCurrentSize() const { return total_; }
+    std::size_t distinctCount() const { return distinct_; }
+    void        clear() { release(); }
+
+    // adds n copies of item
+    bool add(const T& item, std::size_t n = 1) {
+        if (n == 0) return true;
+        std::size_t h = hasher_(item);
+        if (cap_) {
+            std::size_t i = probe(item, h);
+            if (slots_[i].count) { slots_[i].count += n; total_ += n; return true; }
+        }
+        reserveDistinct(distinct_ + 1);
+        std::size_t i = probe(item, h);
+        ::new (static_cast<void*>(slots_[i].buf)) T(item);
+        slots_[i].count = n;
+        slots_[i].hash = h;
+        ++distinct_;
+        total_ += n;
+        return true;
+    }
+
+    // removes one copy
+    bool remove(const T& item) {
+        std::size_t i = find(item);
+        if (i == cap_) return false;
+        --total_;
+        if (--slots_[i].count == 0) erase(i);
+        return true;
+    }
+    // removes every copy; returns how many there were
+    std::size_t removeAll(const T& item) {
+        std::size_t i = find(item);
+        if (i == cap_) return 0;
+        std::size_t n = slots_[i].count;
+        total_ -= n;
+        erase(i);
+        return n;
+    }
+
+    bool contains(const T& item) const { return find(item) != cap_; }
+
+    std::size_t getFrequencyOf(const T& item) const {
+        std::size_t i = find(item);
+        return i == cap_ ? 0 : slots_[i].count;
+    }
+
+    template <class It>
+    void addAll(It first, It last) {
+        for (; first != last; ++first) add(*first);
+    }
+    void addAll(std::initializer_list<T> il) { addAll(il.begin(), il.end()); }
+
+    // adds every copy of every item in other (multiset sum)
+    void merge(const HashBag& other) {
+        if (&other == this) {
+            for (std::size_t i = 0; i < cap_; ++i) slots_[i].count *= 2;
+            total_ *= 2;
+            return;
+        }
+        reserveDistinct(distinct_ + other.distinct_);
+        for (auto e : other) add(e.first, e.second);
+    }
+
+    // distinct items with their counts
+    const_iterator begin() const { return const_iterator(slots_, slots_ + cap_); }
+    const_iterator end() const { return const_iterator(slots_ + cap_, slots_ + cap_); }
+};
+
+#endif
@@ -4,13 +4,16 @@
 #define JOSEPHUS_H
 
 #include "Queue.h"
+#include "FenwickTree.h"
 #include <vector>
 
-inline std::vector<int> josephusOrder(int N, int M) {
+// Q is any queue of int with enqueue/dequeue/front/getSize, e.g. RingQueue<int>
+template <class Q = Queue<int>>
+std::vector<int> josephusOrder(int N, int M) {
     std::vector<int> out;
     if (N <= 0) return out;
 
-    Queue<int> q;
+    Q q;
     for (int i = 1; i <= N; ++i) q.enqueue(i);
 
     while (q.getSize() > 1) {
@@ -25,9 +28,10 @@ inline std::vector<int> josephusOrder(int N, int M) {
     return out; // does not include the winner
 }
 
-inline int josephusWinner(int N, int M) {
+template <class Q = Queue<int>>
+int josephusWinner(int N, int M) {
     if (N <= 0) return -1;
-    Queue<int> q;
+    Q q;
     for (int i = 1; i <= N; ++i) q.enqueue(i);
 
     while (q.getSize() > 1) {
@@ -41,4 +45,61 @@ inline int josephusWinner(int N, int M) {
     return q.front();
 }
 
+// The game above with step k = M + 1: M people are passed, the next one
+// is out. Positions below are 0-based inside the math and 1-based in the
+// results, matching the simulation.
+
+// O(N): J(1) = 0, J(n) = (J(n-1) + k) mod n
+inline long long josephusWinnerLinear(long long N, long long M) {
+    if (N <= 0) return -1;
+    long long j = 0;
+    for (long long n = 2; n <= N; ++n) j = (j + M % n + 1) % n;
+    return j + 1;
+}
+
+// O(k log N) for step k = M + 1, for huge N and small M. One pass around
+// the circle removes every k-th person, N/k of them at once, so the
+// problem shrinks to N - N/k people; the survivor's index among them maps
+// back by skipping the removed slots. Sizes below k use the linear
+// recurrence. Iterative so huge N can't overflow the call stack; sizes is
+// scratch space, reusable across calls.
+inline long long josephusWinnerFast(long long N, long long M, std::vector<long long>& sizes) {
+    if (N <= 0) return -1;
+    const long long k = M + 1;
+    if (k == 1) return N;
+    sizes.clear();                  // the shrinking n, outermost first
+    long long n = N;
+    while (n >= k) { sizes.push_back(n); n -= n / k; }
+    long long j = 0;                // J(n) for the small base case
+    for (long long m = 2; m <= n; ++m) j = (j + k) % m;
+    for (std::size_t i = sizes.size(); i-- > 0;) {
+        long long big = sizes[i];
+        j -= big % k;
+        if (j < 0) j += big;
+        else       j += j / (k - 1);
+    }
+    return j + 1;
+}
+inline long long josephusWinnerFast(long long N, long long M) {
+    std::vector<long long> sizes;
+    return josephusWinnerFast(N, M, sizes);
+}
+
+// O(N log N) elimination order (winner excluded, like josephusOrder):
+// a Fenwick tree over the survivors finds the r-th one still standing.
+inline std::vector<int> josephusOrderFenwick(int N, int M) {
+    std::vector<int> out;
+    if (N <= 0) return out;
+    out.reserve((std::size_t)N - 1);
+    FenwickTree<int> alive((std::size_t)N, 1);
+    long long rank = 0;   // 0-based rank of the current front among survivors
+    for (long long left = N; left > 1; --left) {
+        rank = (rank + M % left) % left;
+        std::size_t pos = alive.findKth((int)rank + 1);
+        out.push_back((int)pos);
+        alive.add(pos, -1);
+    }
+    return out;
+}
+
 #endif
@@ -0,0 +1,243 @@
+#pragma once
+// JosephusBatch.h
+// Answers many josephusWinner(N, M) queries at once on a pool of worker
+// threads.
+//
+//   JosephusEngine engine;                 // hardware_concurrency threads
+//   engine.winners(queries, count, out);   // out[i] = winner of queries[i]
+//
+// Queries are planned per distinct M. A group whose largest N is small
+// next to its query count is answered by one sweep of the survivor
+// recurrence J(n) = (J(n-1) + k) mod n up to that N, picking off each
+// query's answer as n reaches it. Sweeps for up to kLanes different M run
+// side by side, one lane each, so the inner step is a short fixed-width
+// loop the compiler turns into SIMD adds/compares. Once n > k the mod is
+// a single conditional subtract. Other groups (huge N, few queries) use
+// josephusWinnerFast per query. Each thread keeps its own scratch for that.
+#ifndef JOSEPHUS_BATCH_H
+#define JOSEPHUS_BATCH_H
+
+#include "Josephus.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+struct JosephusQuery {
+    long long N;
+    long long M;
+};
+
+class JosephusEngine {
+public:
+    static constexpr std::size_t kLanes = 8;
+
+private:
+    // one query, as planned (M <= 0 and N <= 0 are answered up front)
+    struct Key {
+        long long M, N;
+        std::size_t index;
+        bool operator<(const Key& o) const { return M != o.M ? M < o.M : N < o.N; }
+    };
+    // queries sharing one M, as a run of order_ sorted by N
+    struct Group {
+        std::size_t begin, end;
+        long long k;       // M + 1
+        long long maxN;
+    };
+    struct Task {
+        bool sweep;
+        std::size_t begin, end;   // sweep: range of sweeps_; fast: range of fast_
+    };
+    struct Scratch {
+        std::vector<long long> sizes;   // josephusWinnerFast's shrinking sizes
+    };
+
+    // the current batch, written by winners() before the workers wake
+    const JosephusQuery* q_ = nullptr;
+    long long* out_ = nullptr;
+    std::vector<Key> order_;           // queries sorted by (M, N)
+    std::vector<Group> sweeps_;        // groups answered by a sweep, by maxN
+    std::vector<std::size_t> fast_;    // queries answered one at a time
+    std::vector<Task> tasks_;
+    std::atomic<std::size_t> nextTask_{0};
+
+    std::vector<std::thread> workers_;
+    std::mutex m_;
+    std::condition_variable wake_, done_;
+    std::size_t generation_ = 0;
+    std::size_t busy_ = 0;
+    bool stop_ = false;
+    Scratch callerScratch_;
+
+    // up to kLanes sweeps side by side
+    void runSweeps(const Group* g, std::size_t lanes) {
+        long long j[kLanes], k[kLanes];
+        std::size_t at[kLanes];
+        long long maxK = 1;
+        for (std::size_t l = 0; l < kLanes; ++l) {
+            j[l] = 0;   // J(1)
+            k[l] = l < lanes ? g[l].k : 1;
+            at[l] = l < lanes ? g[l].begin : 0;
+            if (k[l] > maxK) maxK = k[l];
+        }
+        const long long kDone = -1;
+        long long n = 1;
+        for (;;) {
+            // answer everything asked at the current n, find the next stop
+            long long stop = kDone;
+            for (std::size_t l = 0; l < lanes; ++l) {
+                while (at[l] < g[l].end && order_[at[l]].N == n) out_[order_[at[l]++].index] = j[l] + 1;
+                if (at[l] < g[l].end) {
+                    long long want = order_[at[l]].N;
+                    if (stop == kDone || want < stop) stop = want;
+                }
+            }
+            if (stop == kDone) return;
+
+            // until n passes every k, step with a real mod
+            for (; n < stop && n < maxK; ) {
+                ++n;
+                for (std::size_t l = 0; l < kLanes; ++l) j[l] = (j[l] + k[l]) % n;
+            }
+            // k < n from here on, so j + k < 2n and one subtract wraps it
+            for (; n < stop; ) {
+                ++n;
+                for (std::size_t l = 0; l < kLanes; ++l) {
+                    long long t = j[l] + k[l];
+                    j[l] = t >= n ? t - n : t;
+                }
+            }
+        }
+    }
+
+    void runTask(const Task& t, Scratch& s) {
+        if (t.sweep) {
+            for (std::size_t i = t.begin; i < t.end; i += kLanes)
+                runSweeps(&sweeps_[i], std::min(kLanes, t.end - i));
+        } else {
+            for (std::size_t i = t.begin; i < t.end; ++i) {
+                const JosephusQuery& qq = q_[fast_[i]];
+                out_[fast_[i]] = josephusWinnerFast(qq.N, qq.M, s.sizes);
+            }
+        }
+    }
+
+    void drain(Scratch& s) {
+        for (;;) {
+            std::size_t t = nextTask_.fetch_add(1, std::memory_order_relaxed);
+            if (t >= tasks_.size()) return;
+            runTask(tasks_[t], s);
+        }
+    }
+
+    void workerLoop() {
+        Scratch s;
+        std::size_t seen = 0;
+        for (;;) {
+            {
+                std::unique_lock<std::mutex> g(m_);
+                wake_.wait(g, [&] { return stop_ || generation_ != seen; });
+                if (stop_) return;
+                seen = generation_;
+            }
+            drain(s);
+            std::lock_guard<std::mutex> g(m_);
+            if (--busy_ == 0) done_.notify_one();
+        }
+    }
+
+    // rough step counts for the two ways to answer a group
+    static double sweepCost(const Group& g) {
+        return (double)g.maxN / kLanes + (double)std::min(g.k, g.maxN);
+    }
+    static double fastCost(const Group& g) {
+        double perQuery = (double)g.k * (std::log((double)g.maxN) + 1.0);
+        if (perQuery > (double)g.maxN) perQuery = (double)g.maxN;
+        return (double)(g.end - g.begin) * perQuery;
+    }
+
+    void plan(std::size_t count) {
+        order_.clear();
+        sweeps_.clear();
+        fast_.clear();
+        tasks_.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            if (q_[i].N <= 0) out_[i] = -1;
+            else if (q_[i].M <= 0) out_[i] = q_[i].N;   // no passing: the last one wins
+            else order_.push_back(Key{q_[i].M, q_[i].N, i});
+        }
+        std::sort(order_.begin(), order_.end());
+        for (std::size_t b = 0; b < order_.size();) {
+            std::size_t e = b;
+            long long M = order_[b].M;
+            while (e < order_.size() && order_[e].M == M) ++e;
+            Group g{b, e, M + 1, order_[e - 1].N};
+            if (sweepCost(g) <= fastCost(g)) sweeps_.push_back(g);
+            else for (std::size_t i = b; i < e; ++i) fast_.push_back(order_[i].index);
+            b = e;
+        }
+        // lanes of one sweep run to the longest lane's N, so pair similar ones
+        std::sort(sweeps_.begin(), sweeps_.end(),
+                  [](const Group& a, const Group& b) { return a.maxN < b.maxN; });
+        for (std::size_t i = 0; i < sweeps_.size(); i += kLanes)
+            tasks_.push_back(Task{true, i, std::min(i + kLanes, sweeps_.size())});
+        const std::size_t chunk = 256;
+        for (std::size_t i = 0; i < fast_.size(); i += chunk)
+            tasks_.push_back(Task{false, i, std::min(i + chunk, fast_.size())});
+    }
+
+public:
+    // threads counts the calling thread; 0 means hardware_concurrency
+    explicit JosephusEngine(unsigned threads = 0) {
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned t = 1; t < threads; ++t) workers_.emplace_back([this] { workerLoop(); });
+    }
+    JosephusEngine(const JosephusEngine&) = delete;
+    JosephusEngine& operator=(const JosephusEngine&) = delete;
+    ~JosephusEngine() {
+        {
+            std::lock_guard<std::mutex> g(m_);
+            stop_ = true;
+        }
+        wake_.notify_all();
+        for (auto& w : workers_) w.join();
+    }
+
+    std::size_t threadCount() const { return workers_.size() + 1; }
+
+    // out[i] = josephusWinner(queries[i].N, queries[i].M), or -1 for N <= 0.
+    // One batch at a time: winners() is not reentrant.
+    void winners(const JosephusQuery* queries, std::size_t count, long long* out) {
+        q_ = queries;
+        out_ = out;
+        plan(count);
+        nextTask_.store(0, std::memory_order_relaxed);
+        if (!workers_.empty() && tasks_.size() > 1) {
+            {
+                std::lock_guard<std::mutex> g(m_);
+                ++generation_;
+                busy_ = workers_.size();
+            }
+            wake_.notify_all();
+            drain(callerScratch_);
+            std::unique_lock<std::mutex> g(m_);
+            done_.wait(g, [this] { return busy_ == 0; });
+        } else {
+            drain(callerScratch_);
+        }
+    }
+    std::vector<long long> winners(const std::vector<JosephusQuery>& queries) {
+        std::vector<long long> out(queries.size());
+        winners(queries.data(), queries.size(), out.data());
+        return out;
+    }
+};
+
+#endif
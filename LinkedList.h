@@ -4,9 +4,14 @@
 #define LINKED_LIST_H
 
 #include "ListInterface.h"
+#include "NodePool.h"
+#include <cstddef>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 
-template <class T>
+// NodeAlloc picks where nodes come from; see NodePool.h
+template <class T, class NodeAlloc = NewNodeAlloc>
 class LinkedList : public ListInterface<T> {
 private:
     struct Node {
@@ -15,11 +20,30 @@ private:
         Node(const T& item, Node* n = nullptr) : data(item), next(n) {}
     };
 
+    using Pool = typename NodeAlloc::template Pool<Node>;
+
+    Pool  pool;
     Node* head = nullptr;
+    Node* tail = nullptr;   // last node, so appends don't walk the list
     size_t sz = 0;
 
+    Node* makeNode(const T& item, Node* next = nullptr) {
+        void* p = pool.allocate();
+        try {
+            return ::new (p) Node(item, next);
+        } catch (...) {
+            pool.deallocate(p);
+            throw;
+        }
+    }
+    void destroyNode(Node* n) noexcept {
+        n->~Node();
+        pool.deallocate(n);
+    }
+
     Node* getNodeAt(size_t pos) const {
         if (pos < 1 || pos > sz) throw std::out_of_range("invalid pos");
+        if (pos == sz) return tail;
         Node* cur = head;
         for (size_t i = 1; i < pos; ++i) cur = cur->next;
         return cur;
@@ -27,9 +51,8 @@ private:
 
     void copyFrom(const LinkedList& other) {
         Node* cur = other.head;
-        Node* tail = nullptr;
         while (cur) {
-            Node* n = new Node(cur->data);
+            Node* n = makeNode(cur->data);
             if (!head) head = n;
             else       tail->next = n;
             tail = n;
@@ -38,7 +61,41 @@ private:
         }
     }
 
+    // forward iterator over the nodes; Ref/Ptr pick mutable vs const
+    template <class Ref, class Ptr>
+    class Iter {
+    private:
+        friend class LinkedList;
+        template <class, class> friend class Iter;
+        Node* cur = nullptr;
+        explicit Iter(Node* n) : cur(n) {}
+        Node* node() const { return cur; }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = Ref;
+        using pointer           = Ptr;
+
+        Iter() = default;
+        // iterator -> const_iterator (not the other way)
+        template <class R2, class P2,
+                  class = typename std::enable_if<std::is_convertible<P2, Ptr>::value>::type>
+        Iter(const Iter<R2, P2>& o) : cur(o.cur) {}
+
+        Ref operator*() const { return cur->data; }
+        Ptr operator->() const { return &cur->data; }
+        Iter& operator++() { cur = cur->next; return *this; }
+        Iter operator++(int) { Iter t = *this; cur = cur->next; return t; }
+        friend bool operator==(const Iter& a, const Iter& b) { return a.cur == b.cur; }
+        friend bool operator!=(const Iter& a, const Iter& b) { return a.cur != b.cur; }
+    };
+
 public:
+    using iterator       = Iter<T&, T*>;
+    using const_iterator = Iter<const T&, const T*>;
+
     LinkedList() = default;
     ~LinkedList() override { clear(); }
 
@@ -48,14 +105,16 @@ public:
         return *this;
     }
 
-    LinkedList(LinkedList&& rhs) noexcept : head(rhs.head), sz(rhs.sz) {
-        rhs.head = nullptr; rhs.sz = 0;
+    LinkedList(LinkedList&& rhs) noexcept : head(rhs.head), tail(rhs.tail), sz(rhs.sz) {
+        pool.swap(rhs.pool);
+        rhs.head = rhs.tail = nullptr; rhs.sz = 0;
     }
     LinkedList& operator=(LinkedList&& rhs) noexcept {
         if (this != &rhs) {
             clear();
-            head = rhs.head; sz = rhs.sz;
-            rhs.head = nullptr; rhs.sz = 0;
+            pool.swap(rhs.pool);   // rhs gets our pool, emptied by clear()
+            head = rhs.head; tail = rhs.tail; sz = rhs.sz;
+            rhs.head = rhs.tail = nullptr; rhs.sz = 0;
         }
         return *this;
     }
@@ -65,28 +124,37 @@ public:
 
     bool insert(size_t pos, const T& entry) override {
         if (pos < 1 || pos > sz + 1) return false;
-        if (pos == 1) head = new Node(entry, head);
+        if (pos == 1) push_front(entry);
+        else if (pos == sz + 1) push_back(entry);
         else {
             Node* prev = getNodeAt(pos - 1);
-            prev->next = new Node(entry, prev->next);
+            prev->next = makeNode(entry, prev->next);
+            ++sz;
         }
-        ++sz; return true;
+        return true;
     }
 
     bool remove(size_t pos) override {
         if (pos < 1 || pos > sz) return false;
-        Node* doomed;
-        if (pos == 1) { doomed = head; head = head->next; }
-        else {
-            Node* prev = getNodeAt(pos - 1);
-            doomed = prev->next;
-            prev->next = doomed->next;
-        }
-        delete doomed; --sz; return true;
+        if (pos == 1) { pop_front(); return true; }
+        Node* prev = getNodeAt(pos - 1);
+        Node* doomed = prev->next;
+        prev->next = doomed->next;
+        if (doomed == tail) tail = prev;
+        destroyNode(doomed); --sz; return true;
     }
 
+    // With a list-owned pool the slabs go back wholesale instead of node by
+    // node (nodes still get their destructors run unless T is trivial).
     void clear() override {
-        while (head) { Node* n = head; head = head->next; delete n; }
+        if (Pool::kBulkRelease) {
+            if (!std::is_trivially_destructible<Node>::value)
+                for (Node* n = head; n;) { Node* next = n->next; n->~Node(); n = next; }
+            pool.release();
+        } else {
+            while (head) { Node* n = head; head = head->next; destroyNode(n); }
+        }
+        head = tail = nullptr;
         sz = 0;
     }
 
@@ -97,5 +165,68 @@ public:
         if (pos < 1 || pos > sz) return false;
         getNodeAt(pos)->data = entry; return true;
     }
+
+    // iteration
+    iterator begin() { return iterator(head); }
+    iterator end() { return iterator(nullptr); }
+    const_iterator begin() const { return const_iterator(head); }
+    const_iterator end() const { return const_iterator(nullptr); }
+    const_iterator cbegin() const { return const_iterator(head); }
+    const_iterator cend() const { return const_iterator(nullptr); }
+
+    // end access and cursor edits, all O(1). pos must be a valid (non-end) iterator.
+    T& front() {
+        if (!head) throw std::out_of_range("front on empty list");
+        return head->data;
+    }
+    const T& front() const {
+        if (!head) throw std::out_of_range("front on empty list");
+        return head->data;
+    }
+    T& back() {
+        if (!tail) throw std::out_of_range("back on empty list");
+        return tail->data;
+    }
+    const T& back() const {
+        if (!tail) throw std::out_of_range("back on empty list");
+        return tail->data;
+    }
+
+    iterator push_front(const T& entry) {
+        head = makeNode(entry, head);
+        if (!tail) tail = head;
+        ++sz; return iterator(head);
+    }
+    iterator push_back(const T& entry) {
+        Node* n = makeNode(entry);
+        if (tail) tail->next = n;
+        else      head = n;
+        tail = n;
+        ++sz; return iterator(n);
+    }
+    void pop_front() {
+        if (!head) throw std::out_of_range("pop_front on empty list");
+        Node* doomed = head;
+        head = head->next;
+        if (!head) tail = nullptr;
+        destroyNode(doomed); --sz;
+    }
+    // insert after pos; returns the new element
+    iterator insertAfter(const_iterator pos, const T& entry) {
+        Node* prev = pos.node();
+        prev->next = makeNode(entry, prev->next);
+        if (prev == tail) tail = prev->next;
+        ++sz; return iterator(prev->next);
+    }
+    // erase the element after pos; returns the one that followed it
+    iterator eraseAfter(const_iterator pos) {
+        Node* prev = pos.node();
+        Node* doomed = prev->next;
+        if (!doomed) throw std::out_of_range("eraseAfter at last element");
+        prev->next = doomed->next;
+        if (doomed == tail) tail = prev;
+        destroyNode(doomed); --sz;
+        return iterator(prev->next);
+    }
 };
 #endif
@@ -0,0 +1,274 @@
+#pragma once
+// MappedVector.h
+// Persistence for Vector<T> of trivially copyable T (POSIX).
+//
+//   saveVector(v, path)        write v to a versioned binary file
+//   loadVector(path, v)        read it back into a Vector (one copy)
+//   MappedVector<T> m(path)    read-only view straight over the mmap'd
+//                              file: O(1) open, pages fault in on use
+//   MappedVector<T>::appendTo  writable mapping you can push_back into,
+//                              msync'd every N appends
+//
+// File layout: a 64-byte VectorFileHeader, then count * sizeof(T) bytes of raw
+// elements in native byte order.
+#ifndef MAPPED_VECTOR_H
+#define MAPPED_VECTOR_H
+
+#include "Vector.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+struct VectorFileHeader {
+    static constexpr char          kMagic[8] = {'V', 'E', 'C', 'T', 'B', 'I', 'N', '\0'};
+    static constexpr std::uint32_t kVersion = 1;
+
+    char          magic[8];
+    std::uint32_t version;
+    std::uint32_t elemSize;    // sizeof(T) of the writer
+    std::uint32_t elemAlign;   // alignof(T) of the writer
+    std::uint32_t reserved;
+    std::uint64_t count;       // number of elements that follow
+    unsigned char pad[32];     // keep the data 64-byte aligned
+
+    template <class T>
+    static VectorFileHeader make(std::uint64_t n) {
+        VectorFileHeader h{};
+        std::memcpy(h.magic, kMagic, sizeof kMagic);
+        h.version = kVersion;
+        h.elemSize = (std::uint32_t)sizeof(T);
+        h.elemAlign = (std::uint32_t)alignof(T);
+        h.count = n;
+        return h;
+    }
+
+    // throws unless this header describes a file of T written by us
+    template <class T>
+    void check(const char* path) const {
+        if (std::memcmp(magic, kMagic, sizeof kMagic) != 0)
+            throw std::runtime_error(std::string("not a vector file: ") + path);
+        if (version != kVersion)
+            throw std::runtime_error(std::string("unsupported vector file version: ") + path);
+        if (elemSize != sizeof(T) || elemAlign != alignof(T))
+            throw std::runtime_error(std::string("element type mismatch: ") + path);
+    }
+};
+static_assert(sizeof(VectorFileHeader) == 64, "header must stay 64 bytes");
+
+template <class T, class G, class S, class Sh>
+void saveVector(const Vector<T, G, S, Sh>& v, const char* path) {
+    static_assert(std::is_trivially_copyable<T>::value, "saveVector needs trivially copyable T");
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) throw std::runtime_error(std::string("cannot open for writing: ") + path);
+    VectorFileHeader h = VectorFileHeader::make<T>(v.size());
+    out.write(reinterpret_cast<const char*>(&h), sizeof h);
+    out.write(reinterpret_cast<const char*>(v.data()), (std::streamsize)(v.size() * sizeof(T)));
+    if (!out) throw std::runtime_error(std::string("write failed: ") + path);
+}
+
+template <class T, class G, class S, class Sh>
+void loadVector(const char* path, Vector<T, G, S, Sh>& v) {
+    static_assert(std::is_trivially_copyable<T>::value, "loadVector needs trivially copyable T");
+    std::ifstream in(path, std::ios::binary);
+    if (!in) throw std::runtime_error(std::string("cannot open: ") + path);
+    VectorFileHeader h;
+    if (!in.read(reinterpret_cast<char*>(&h), sizeof h))
+        throw std::runtime_error(std::string("truncated vector file: ") + path);
+    h.check<T>(path);
+    // the count is only a claim; don't allocate for more than the file holds
+    std::streamoff here = in.tellg();
+    in.seekg(0, std::ios::end);
+    std::streamoff remaining = in.tellg() - here;
+    in.seekg(here);
+    if (!in || remaining < 0 || h.count > (std::uint64_t)remaining / sizeof(T))
+        throw std::runtime_error(std::string("truncated vector file: ") + path);
+    v.clear();
+    v.resize((std::size_t)h.count);
+    if (!in.read(reinterpret_cast<char*>(v.data()), (std::streamsize)(h.count * sizeof(T))))
+        throw std::runtime_error(std::string("truncated vector file: ") + path);
+}
+
+template <class T>
+class MappedVector {
+    static_assert(std::is_trivially_copyable<T>::value, "MappedVector needs trivially copyable T");
+    static_assert(alignof(T) <= sizeof(VectorFileHeader), "element alignment above 64");
+
+private:
+    int fd_ = -1;
+    unsigned char* base_ = nullptr;   // mapping; header at offset 0
+    std::size_t mapLen_ = 0;
+    std::size_t cap_ = 0;             // elements the mapping can hold
+    bool writable_ = false;
+    std::size_t syncEvery_ = 0;       // appends between msync(MS_ASYNC); 0 = never
+    std::size_t sinceSync_ = 0;
+
+    VectorFileHeader* header() const { return reinterpret_cast<VectorFileHeader*>(base_); }
+    T* elems() const { return reinterpret_cast<T*>(base_ + sizeof(VectorFileHeader)); }
+
+    static std::runtime_error sysError(const char* what, const char* path) {
+        return std::runtime_error(std::string(what) + " " + path + ": " + std::strerror(errno));
+    }
+
+    void map(std::size_t len, const char* path) {
+        int prot = writable_ ? (PROT_READ | PROT_WRITE) : PROT_READ;
+        void* p = mmap(nullptr, len, prot, MAP_SHARED, fd_, 0);
+        if (p == MAP_FAILED) throw sysError("mmap", path);
+        base_ = static_cast<unsigned char*>(p);
+        mapLen_ = len;
+        cap_ = (len - sizeof(VectorFileHeader)) / sizeof(T);
+    }
+
+    // double the file and the mapping (writable mode only)
+    void grow() {
+        std::size_t newCap = cap_ ? cap_ * 2 : 1024;
+        std::size_t newLen = sizeof(VectorFileHeader) + newCap * sizeof(T);
+        if (ftruncate(fd_, (off_t)newLen) != 0) throw sysError("ftruncate", "mapped vector");
+        void* p = mremap(base_, mapLen_, newLen, MREMAP_MAYMOVE);
+        if (p == MAP_FAILED) throw sysError("mremap", "mapped vector");
+        base_ = static_cast<unsigned char*>(p);
+        mapLen_ = newLen;
+        cap_ = newCap;
+    }
+
+    void close() {
+        if (base_) {
+            if (writable_) {
+                std::size_t used = sizeof(VectorFileHeader) + count() * sizeof(T);
+                msync(base_, mapLen_, MS_SYNC);
+                munmap(base_, mapLen_);
+                // drop the unused tail grow() added; harmless if it fails
+                if (ftruncate(fd_, (off_t)used) != 0) {}
+            } else {
+                munmap(base_, mapLen_);
+            }
+        }
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = -1; base_ = nullptr; mapLen_ = 0; cap_ = 0;
+    }
+
+    // unmap and close without msync or ftruncate: for a file that failed
+    // validation, which must be left exactly as it was
+    void abandon() {
+        if (base_) munmap(base_, mapLen_);
+        if (fd_ >= 0) ::close(fd_);
+        fd_ = -1; base_ = nullptr; mapLen_ = 0; cap_ = 0;
+    }
+
+    std::size_t count() const { return base_ ? (std::size_t)header()->count : 0; }
+
+    MappedVector() = default;
+
+public:
+    // read-only view over a file written by saveVector (or appendTo)
+    explicit MappedVector(const char* path) {
+        fd_ = ::open(path, O_RDONLY);
+        if (fd_ < 0) throw sysError("open", path);
+        struct stat st;
+        if (fstat(fd_, &st) != 0) { ::close(fd_); throw sysError("fstat", path); }
+        std::size_t len = (std::size_t)st.st_size;
+        try {
+            if (len < sizeof(VectorFileHeader))
+                throw std::runtime_error(std::string("truncated vector file: ") + path);
+            map(len, path);
+            header()->template check<T>(path);
+            if (count() > cap_)
+                throw std::runtime_error(std::string("truncated vector file: ") + path);
+        } catch (...) {
+            close();
+            throw;
+        }
+    }
+
+    // writable mapping for appends; creates the file if it doesn't exist.
+    // Every syncEvery appends the new data is handed to msync(MS_ASYNC).
+    static MappedVector appendTo(const char* path, std::size_t syncEvery = 4096) {
+        MappedVector m;
+        m.writable_ = true;
+        m.syncEvery_ = syncEvery;
+        m.fd_ = ::open(path, O_RDWR | O_CREAT, 0644);
+        if (m.fd_ < 0) throw sysError("open", path);
+        // until the header checks out, errors leave the file untouched
+        try {
+            struct stat st;
+            if (fstat(m.fd_, &st) != 0) throw sysError("fstat", path);
+            std::size_t len = (std::size_t)st.st_size;
+            if (len == 0) {
+                VectorFileHeader h = VectorFileHeader::make<T>(0);
+                if (::write(m.fd_, &h, sizeof h) != (ssize_t)sizeof h) throw sysError("write", path);
+                len = sizeof h;
+            } else if (len < sizeof(VectorFileHeader)) {
+                throw std::runtime_error(std::string("truncated vector file: ") + path);
+            }
+            m.map(len, path);
+            m.header()->template check<T>(path);
+            if (m.count() > m.cap_)
+                throw std::runtime_error(std::string("truncated vector file: ") + path);
+        } catch (...) {
+            m.abandon();
+            throw;
+        }
+        return m;
+    }
+
+    MappedVector(const MappedVector&) = delete;
+    MappedVector& operator=(const MappedVector&) = delete;
+    MappedVector(MappedVector&& rhs) noexcept { *this = std::move(rhs); }
+    MappedVector& operator=(MappedVector&& rhs) noexcept {
+        if (this != &rhs) {
+            close();
+            fd_ = rhs.fd_; base_ = rhs.base_; mapLen_ = rhs.mapLen_; cap_ = rhs.cap_;
+            writable_ = rhs.writable_; syncEvery_ = rhs.syncEvery_; sinceSync_ = rhs.sinceSync_;
+            rhs.fd_ = -1; rhs.base_ = nullptr; rhs.mapLen_ = 0; rhs.cap_ = 0;
+        }
+        return *this;
+    }
+    ~MappedVector() { close(); }
+
+    // basic queries
+    std::size_t size()  const { return count(); }
+    bool        empty() const { return count() == 0; }
+
+    // element access
+    const T& operator[](std::size_t i) const { return elems()[i]; }
+    const T& at(std::size_t i) const {
+        if (i >= size()) throw std::out_of_range("at");
+        return elems()[i];
+    }
+
+    // iteration helpers
+    const T* data()  const { return elems(); }
+    const T* begin() const { return elems(); }
+    const T* end()   const { return elems() + size(); }
+
+    // append (writable mode only). The header count is bumped after the
+    // element is written, so a reader never sees a half-written element.
+    void push_back(const T& x) {
+        if (!writable_) throw std::logic_error("push_back on read-only MappedVector");
+        std::size_t n = count();
+        if (n == cap_) grow();
+        elems()[n] = x;
+        header()->count = n + 1;
+        if (syncEvery_ && ++sinceSync_ >= syncEvery_) {
+            msync(base_, mapLen_, MS_ASYNC);
+            sinceSync_ = 0;
+        }
+    }
+
+    // block until everything appended so far is on disk
+    void sync() {
+        if (writable_ && base_ && msync(base_, mapLen_, MS_SYNC) != 0)
+            throw sysError("msync", "mapped vector");
+        sinceSync_ = 0;
+    }
+};
+
+#endif
@@ -0,0 +1,161 @@
+#pragma once
+// MpmcQueue.h
+// Bounded lock-free FIFO for any number of producer and consumer threads.
+// Each slot carries a sequence number saying whose turn it is: slot i is
+// free for the producer holding ticket pos when seq == pos, and holds an
+// item for the consumer holding ticket pos when seq == pos + 1. A thread
+// claims a ticket with one CAS on the shared index, then works on its
+// slot without touching anyone else's. Producer and consumer indices sit
+// on separate cache lines.
+//
+// try_enqueue/try_dequeue never block; enqueue/dequeue yield until they
+// succeed. The batch forms claim a run of consecutive slots with one CAS.
+// Constructing T into a claimed slot must not throw: the ticket can't be
+// handed back, so the consumers behind it would wait forever.
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <stdexcept>
+#include <thread>    // std::this_thread::yield
+#include <utility>
+
+template <class T>
+class MpmcQueue {
+private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    struct Cell {
+        std::atomic<std::size_t> seq;
+        alignas(T) unsigned char buf[sizeof(T)];
+        T* get() { return std::launder(reinterpret_cast<T*>(buf)); }
+    };
+
+    static std::size_t roundUp(std::size_t n) {
+        std::size_t c = 2;
+        while (c < n) c *= 2;
+        return c;
+    }
+    static std::intptr_t diff(std::size_t a, std::size_t b) { return (std::intptr_t)(a - b); }
+
+    // read-only after construction
+    Cell* cells_;
+    std::size_t mask_;
+
+    alignas(kCacheLine) std::atomic<std::size_t> enqueuePos_{0};
+    alignas(kCacheLine) std::atomic<std::size_t> dequeuePos_{0};
+
+    // Claim up to n consecutive tickets starting at the shared index whose
+    // slots are all in the wanted state (seq == ticket + lag). Returns the
+    // first ticket and sets n to how many were claimed (0: full/empty).
+    std::size_t claim(std::atomic<std::size_t>& index, std::size_t lag, std::size_t& n) {
+        std::size_t pos = index.load(std::memory_order_relaxed);
+        for (;;) {
+            std::intptr_t d = diff(cells_[pos & mask_].seq.load(std::memory_order_acquire), pos + lag);
+            if (d < 0) { n = 0; return pos; }                          // full / empty
+            if (d > 0) { pos = index.load(std::memory_order_relaxed); continue; }   // pos was taken
+            std::size_t k = 1;
+            while (k < n && cells_[(pos + k) & mask_].seq.load(std::memory_order_acquire) == pos + k + lag)
+                ++k;
+            if (index.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed,
+                                            std::memory_order_relaxed)) {
+                n = k;
+                return pos;
+            }
+        }
+    }
+
+public:
+    // capacity is rounded up to a power of two
+    explicit MpmcQueue(std::size_t capacity) {
+        if (capacity == 0) throw std::invalid_argument("MpmcQueue capacity must be positive");
+        std::size_t c = roundUp(capacity);
+        mask_ = c - 1;
+        cells_ = new Cell[c];
+        for (std::size_t i = 0; i < c; ++i) cells_[i].seq.store(i, std::memory_order_relaxed);
+    }
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    // no thread may be using the queue while destroying
+    ~MpmcQueue() {
+        std::size_t t = enqueuePos_.load(std::memory_order_relaxed);
+        for (std::size_t h = dequeuePos_.load(std::memory_order_relaxed); h != t; ++h)
+            cells_[h & mask_].get()->~T();
+        delete[] cells_;
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+    // a snapshot; other threads may change it immediately
+    std::size_t getSize() const {
+        std::size_t h = dequeuePos_.load(std::memory_order_acquire);
+        std::size_t t = enqueuePos_.load(std::memory_order_acquire);
+        return t > h ? t - h : 0;
+    }
+    bool isEmpty() const { return getSize() == 0; }
+
+    bool try_enqueue(const T& x) { return try_emplace(x); }
+    bool try_enqueue(T&& x) { return try_emplace(std::move(x)); }
+    void enqueue(const T& x) {
+        while (!try_emplace(x)) std::this_thread::yield();
+    }
+    void enqueue(T&& x) {
+        while (!try_emplace(std::move(x))) std::this_thread::yield();
+    }
+
+    template <class U>
+    bool try_emplace(U&& x) {
+        std::size_t n = 1;
+        std::size_t pos = claim(enqueuePos_, 0, n);
+        if (n == 0) return false;
+        Cell& c = cells_[pos & mask_];
+        ::new (static_cast<void*>(c.buf)) T(std::forward<U>(x));
+        c.seq.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // copies as many of items[0..n) as there are free consecutive slots;
+    // returns how many
+    std::size_t try_enqueue(const T* items, std::size_t n) {
+        if (n == 0) return 0;
+        std::size_t pos = claim(enqueuePos_, 0, n);
+        for (std::size_t i = 0; i < n; ++i) {
+            Cell& c = cells_[(pos + i) & mask_];
+            ::new (static_cast<void*>(c.buf)) T(items[i]);
+            c.seq.store(pos + i + 1, std::memory_order_release);
+        }
+        return n;
+    }
+
+    bool try_dequeue(T& out) {
+        std::size_t n = 1;
+        std::size_t pos = claim(dequeuePos_, 1, n);
+        if (n == 0) return false;
+        Cell& c = cells_[pos & mask_];
+        out = std::move(*c.get());
+        c.get()->~T();
+        c.seq.store(pos + mask_ + 1, std::memory_order_release);
+        return true;
+    }
+    void dequeue(T& out) {
+        while (!try_dequeue(out)) std::this_thread::yield();
+    }
+
+    // moves up to max consecutive ready items into out[0..); returns how many
+    std::size_t try_dequeue(T* out, std::size_t max) {
+        if (max == 0) return 0;
+        std::size_t pos = claim(dequeuePos_, 1, max);
+        for (std::size_t i = 0; i < max; ++i) {
+            Cell& c = cells_[(pos + i) & mask_];
+            out[i] = std::move(*c.get());
+            c.get()->~T();
+            c.seq.store(pos + i + mask_ + 1, std::memory_order_release);
+        }
+        return max;
+    }
+};
+
+#endif
@@ -0,0 +1,71 @@
+#pragma once
+// MremapStorage.h
+// Large-buffer storage policy for Vector<T> (Linux only).
+//
+// Blocks below Threshold bytes come from operator new as usual. From
+// Threshold up they are anonymous mmap regions, and growing one is an
+// mremap: the kernel moves page-table entries instead of us copying the
+// whole buffer, and there is never an old+new copy alive at once.
+// Only trivially copyable T get the remap path (Vector checks); other T
+// still work, they just copy on growth.
+#ifndef MREMAP_STORAGE_H
+#define MREMAP_STORAGE_H
+
+#include "Vector.h"
+#include <cstddef>
+#include <new>        // std::bad_alloc
+#include <sys/mman.h>
+#include <unistd.h>   // sysconf
+
+// transparent-huge-page advice hooks; pick one with the HugePages argument
+struct NoHugePageAdvice {
+    static void advise(void*, std::size_t) {}
+};
+struct HugePageAdvice {
+    static void advise(void* p, std::size_t bytes) {
+#ifdef MADV_HUGEPAGE
+        madvise(p, bytes, MADV_HUGEPAGE);   // best effort; failure is harmless
+#else
+        (void)p; (void)bytes;
+#endif
+    }
+};
+
+template <std::size_t Threshold = (std::size_t)1 << 21, class HugePages = NoHugePageAdvice>
+struct MremapStorage {
+    static std::size_t pageRound(std::size_t bytes) {
+        static const std::size_t page = (std::size_t)sysconf(_SC_PAGESIZE);
+        return (bytes + page - 1) / page * page;
+    }
+    static bool mapped(std::size_t bytes) { return bytes >= Threshold; }
+
+    static void* allocate(std::size_t bytes, std::size_t align) {
+        if (!mapped(bytes)) return HeapStorage::allocate(bytes, align);
+        std::size_t len = pageRound(bytes);
+        void* p = mmap(nullptr, len, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (p == MAP_FAILED) throw std::bad_alloc();
+        HugePages::advise(p, len);
+        return p;
+    }
+    static void deallocate(void* p, std::size_t bytes, std::size_t align) {
+        if (!mapped(bytes)) HeapStorage::deallocate(p, bytes, align);
+        else munmap(p, pageRound(bytes));
+    }
+    // only mapped -> mapped blocks can be remapped; crossing the threshold
+    // takes one ordinary allocate + copy
+    static void* remap(void* p, std::size_t oldBytes, std::size_t newBytes) {
+        if (!mapped(oldBytes) || !mapped(newBytes)) return nullptr;
+        std::size_t oldLen = pageRound(oldBytes), newLen = pageRound(newBytes);
+        if (oldLen == newLen) return p;
+        void* q = mremap(p, oldLen, newLen, MREMAP_MAYMOVE);
+        if (q == MAP_FAILED) return nullptr;         // fall back to copying
+        HugePages::advise(q, newLen);
+        return q;
+    }
+};
+
+// Vector<int>/Vector<POD> that switches to mmap + mremap growth past 2 MiB
+template <class T, class Growth = DoublingGrowth>
+using HugeVector = Vector<T, Growth, MremapStorage<>>;
+
+#endif
@@ -0,0 +1,134 @@
+#pragma once
+// NodePool.h
+// Node allocation policies for LinkedList (and the Stack/Queue/Bag built
+// on it). A policy provides `template <class Node> class Pool` with
+// allocate/deallocate of raw node storage, and release() to free
+// everything at once.
+//
+//   NewNodeAlloc          one new/delete per node (the default)
+//   PooledNodeAlloc<N>    each list owns its nodes: slabs of N nodes plus a
+//                         free list; clear() hands back whole slabs
+//   SharedNodeAlloc<N>    one such pool per node type per thread, shared
+//                         by every list on that thread. Nodes go back to
+//                         the calling thread's pool, so a list using it
+//                         must stay on one thread and die before it exits.
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+struct NewNodeAlloc {
+    template <class Node>
+    class Pool {
+    public:
+        static constexpr bool kBulkRelease = false;   // release() can't free nodes
+        void* allocate() { return ::operator new(sizeof(Node)); }
+        void deallocate(void* p) noexcept { ::operator delete(p); }
+        void release() noexcept {}
+        void swap(Pool&) noexcept {}
+    };
+};
+
+template <std::size_t SlabNodes = 64>
+struct PooledNodeAlloc {
+    static_assert(SlabNodes > 0, "SlabNodes must be positive");
+
+    template <class Node>
+    class Pool {
+    private:
+        union Cell {
+            Cell* next;                                   // while on the free list
+            alignas(Node) unsigned char buf[sizeof(Node)];
+        };
+        struct Slab {
+            Slab* prev;
+            Cell  cells[SlabNodes];
+        };
+
+        Slab* slabs = nullptr;     // newest first
+        Cell* freeList = nullptr;  // cells handed back by deallocate
+        Cell* bump = nullptr;      // untouched cells of the newest slab
+        Cell* bumpEnd = nullptr;
+
+        static void* rawAlloc() {
+            if (alignof(Slab) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                return ::operator new(sizeof(Slab), std::align_val_t(alignof(Slab)));
+            return ::operator new(sizeof(Slab));
+        }
+        static void rawFree(Slab* s) noexcept {
+            if (alignof(Slab) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+                ::operator delete(s, std::align_val_t(alignof(Slab)));
+            else
+                ::operator delete(s);
+        }
+
+        [[gnu::noinline]] void* newSlab() {
+            Slab* s = static_cast<Slab*>(rawAlloc());
+            s->prev = slabs;
+            slabs = s;
+            bump = s->cells + 1;
+            bumpEnd = s->cells + SlabNodes;
+            return s->cells;
+        }
+
+    public:
+        static constexpr bool kBulkRelease = true;
+
+        Pool() = default;
+        Pool(const Pool&) = delete;
+        Pool& operator=(const Pool&) = delete;
+        ~Pool() { release(); }
+
+        void* allocate() {
+            if (freeList) {
+                Cell* c = freeList;
+                freeList = c->next;
+                return c;
+            }
+            if (bump != bumpEnd) return bump++;
+            return newSlab();
+        }
+        void deallocate(void* p) noexcept {
+            Cell* c = static_cast<Cell*>(p);
+            c->next = freeList;
+            freeList = c;
+        }
+
+        // frees every slab; all nodes from this pool must already be destroyed
+        void release() noexcept {
+            while (slabs) { Slab* s = slabs; slabs = s->prev; rawFree(s); }
+            freeList = bump = bumpEnd = nullptr;
+        }
+
+        void swap(Pool& o) noexcept {
+            std::swap(slabs, o.slabs);
+            std::swap(freeList, o.freeList);
+            std::swap(bump, o.bump);
+            std::swap(bumpEnd, o.bumpEnd);
+        }
+    };
+};
+
+template <std::size_t SlabNodes = 64>
+struct SharedNodeAlloc {
+    template <class Node>
+    class Pool {
+    private:
+        using Arena = typename PooledNodeAlloc<SlabNodes>::template Pool<Node>;
+        static Arena& arena() {
+            thread_local Arena a;
+            return a;
+        }
+
+    public:
+        static constexpr bool kBulkRelease = false;   // other lists share the slabs
+        void* allocate() { return arena().allocate(); }
+        void deallocate(void* p) noexcept { arena().deallocate(p); }
+        void release() noexcept {}
+        void swap(Pool&) noexcept {}
+    };
+};
+
+#endif
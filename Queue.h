@@ -7,32 +7,32 @@
 #include <stdexcept>
 #include <cstddef>
 
-template <class T>
+template <class T, class NodeAlloc = NewNodeAlloc>
 class Queue {
 private:
-    LinkedList<T> data;   // front is position 1
+    LinkedList<T, NodeAlloc> data;   // front is position 1
 
 public:
     bool isEmpty() const { return data.getLength() == 0; }
     std::size_t getSize() const { return data.getLength(); }
     void clear() { data.clear(); }
 
-    void enqueue(const T& x) {                    // O(n) with current LinkedList
-        data.insert(data.getLength() + 1, x);     // append to back
+    void enqueue(const T& x) {                    // O(1): list tracks its tail
+        data.push_back(x);
     }
 
     void dequeue() {                               // O(1)
         if (isEmpty()) throw std::out_of_range("dequeue on empty queue");
-        data.remove(1);
+        data.pop_front();
     }
 
     T& front() {
         if (isEmpty()) throw std::out_of_range("front on empty queue");
-        return data.getEntry(1);
+        return data.front();
     }
     const T& front() const {
         if (isEmpty()) throw std::out_of_range("front on empty queue");
-        return data.getEntry(1);
+        return data.front();
     }
 };
 
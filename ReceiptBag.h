@@ -4,43 +4,128 @@
 #define RECEIPT_BAG_H
 
 #include "Vector.h"
+#include <cstdint>
 #include <stdexcept>
+#include <utility>
 
+// Slot map: items stay dense (swap-remove keeps them contiguous for
+// iteration) and each receipt names a slot plus that slot's generation.
+// Looking a receipt up is slots[index] -> dense position, so remove is
+// O(1). Removing bumps the slot's generation, so an old receipt for a
+// reused slot no longer matches and is rejected.
 template <class T>
 class ReceiptBag {
+public:
+    // high 32 bits: generation (never 0), low 32 bits: slot index
+    using Receipt = std::uint64_t;
+
 private:
-    Vector<int> recs;
-    Vector<T>   items;
-    int nextRec = 1;
+    struct Slot {
+        std::uint32_t pos;   // dense index while live, next free slot while free
+        std::uint32_t gen;
+    };
+
+    static constexpr std::uint32_t kNone = 0xffffffffu;
+
+    Vector<Slot>          slots;
+    Vector<T>             items;
+    Vector<std::uint32_t> owner;        // items[i] belongs to slots[owner[i]]
+    std::uint32_t         freeHead = kNone;
+
+    static Receipt make(std::uint32_t index, std::uint32_t gen) {
+        return ((Receipt)gen << 32) | index;
+    }
+
+    // dense position for a live receipt, or kNone
+    std::uint32_t find(Receipt receipt) const {
+        std::uint32_t index = (std::uint32_t)receipt;
+        std::uint32_t gen = (std::uint32_t)(receipt >> 32);
+        if (index >= slots.size() || slots[index].gen != gen) return kNone;
+        // a free slot already carries its next generation, so also make
+        // sure the slot is live (its pos points back at it)
+        std::uint32_t pos = slots[index].pos;
+        if (pos >= items.size() || owner[pos] != index) return kNone;
+        return pos;
+    }
 
 public:
     bool isEmpty() const { return items.size() == 0; }
     std::size_t size() const { return items.size(); }
 
-    int insert(const T& x) {
-        recs.push_back(nextRec);
+    // the item goes in first and the slot is taken last, so if anything
+    // throws the bag is left as it was
+    Receipt insert(const T& x) {
+        bool reuse = freeHead != kNone;
+        if (!reuse && slots.size() == kNone) throw std::length_error("ReceiptBag full");
+        std::uint32_t index = reuse ? freeHead : (std::uint32_t)slots.size();
         items.push_back(x);
-        return nextRec++;
+        try {
+            owner.push_back(index);
+        } catch (...) {
+            items.pop_back();
+            throw;
+        }
+        if (reuse) {
+            freeHead = slots[index].pos;
+        } else {
+            try {
+                slots.push_back(Slot{0, 1});
+            } catch (...) {
+                owner.pop_back();
+                items.pop_back();
+                throw;
+            }
+        }
+        slots[index].pos = (std::uint32_t)(items.size() - 1);
+        return make(index, slots[index].gen);
     }
 
-    // removes matching receipt; returns the removed item by value
-    T remove(int receipt) {
-        for (std::size_t i = 0; i < recs.size(); ++i) {
-            if (recs[i] == receipt) {
-                T out = items[i];
+    // true while the receipt's item is still in the bag
+    bool contains(Receipt receipt) const { return find(receipt) != kNone; }
 
-                // swap-remove last into i
-                recs[i] = recs[recs.size() - 1];
-                items[i] = items[items.size() - 1];
+    T& get(Receipt receipt) {
+        std::uint32_t pos = find(receipt);
+        if (pos == kNone) throw std::invalid_argument("invalid receipt");
+        return items[pos];
+    }
+    const T& get(Receipt receipt) const {
+        std::uint32_t pos = find(receipt);
+        if (pos == kNone) throw std::invalid_argument("invalid receipt");
+        return items[pos];
+    }
 
-                recs.pop_back();
-                items.pop_back();
+    // removes matching receipt; returns the removed item by value
+    T remove(Receipt receipt) {
+        std::uint32_t pos = find(receipt);
+        if (pos == kNone) throw std::invalid_argument("invalid receipt");
+        std::uint32_t index = (std::uint32_t)receipt;
 
-                return out;
-            }
+        T out = std::move(items[pos]);
+
+        // swap-remove last into pos and repoint its slot
+        std::size_t last = items.size() - 1;
+        if (pos != last) {
+            items[pos] = std::move(items[last]);
+            owner[pos] = owner[last];
+            slots[owner[pos]].pos = pos;
         }
-        throw std::invalid_argument("invalid receipt");
+        items.pop_back();
+        owner.pop_back();
+
+        // retire the slot: new generation (skipping 0), onto the free list
+        Slot& s = slots[index];
+        if (++s.gen == 0) s.gen = 1;
+        s.pos = freeHead;
+        freeHead = index;
+
+        return out;
     }
+
+    // dense iteration over the items (order changes as items are removed)
+    T* begin() { return items.begin(); }
+    T* end() { return items.end(); }
+    const T* begin() const { return items.begin(); }
+    const T* end()   const { return items.end(); }
 };
 
 #endif
@@ -0,0 +1,231 @@
+#pragma once
+// RingQueue.h
+// FIFO queue over one contiguous power-of-two ring buffer: enqueue and
+// dequeue are an index bump and a mask, with no per-item allocation. The
+// buffer doubles when full (elements are relocated once, in order) and is
+// never shrunk except by clear(). Same interface as Queue, plus
+// try_dequeue and bulk enqueue/dequeue of contiguous runs.
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <class T>
+class RingQueue {
+private:
+    T* buf_ = nullptr;
+    std::size_t cap_ = 0;    // 0 or a power of two
+    std::size_t head_ = 0;   // slot of the front element
+    std::size_t size_ = 0;
+
+    std::size_t mask() const { return cap_ - 1; }
+    T* slot(std::size_t i) const { return buf_ + ((head_ + i) & mask()); }
+
+    static T* allocate(std::size_t n) {
+        if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t(alignof(T))));
+        return static_cast<T*>(::operator new(n * sizeof(T)));
+    }
+    static void deallocate(T* p) {
+        if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) ::operator delete(p, std::align_val_t(alignof(T)));
+        else ::operator delete(p);
+    }
+
+    // the live elements as at most two contiguous runs: [a, a+na), [b, b+nb)
+    void runs(T*& a, std::size_t& na, T*& b, std::size_t& nb) const {
+        a = buf_ + head_;
+        na = cap_ - head_ < size_ ? cap_ - head_ : size_;
+        b = buf_;
+        nb = size_ - na;
+    }
+
+    static void destroyRun(T* p, std::size_t n) {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+            for (std::size_t i = 0; i < n; ++i) p[i].~T();
+    }
+
+    // construct n elements at dst from src: memcpy, nothrow move, or copy
+    static void transfer(T* src, std::size_t n, T* dst) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (n) std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        } else {
+            std::size_t i = 0;
+            try {
+                for (; i < n; ++i) ::new (static_cast<void*>(dst + i)) T(std::move_if_noexcept(src[i]));
+            } catch (...) {
+                destroyRun(dst, i);
+                throw;
+            }
+        }
+    }
+
+    // relocate into a buffer of newCap slots, front at slot 0
+    void regrow(std::size_t newCap) {
+        T* nb = allocate(newCap);
+        T *a, *b;
+        std::size_t na, nbn;
+        runs(a, na, b, nbn);
+        try {
+            transfer(a, na, nb);
+            try {
+                transfer(b, nbn, nb + na);
+            } catch (...) {
+                destroyRun(nb, na);
+                throw;
+            }
+        } catch (...) {
+            deallocate(nb);
+            throw;
+        }
+        destroyRun(a, na);
+        destroyRun(b, nbn);
+        if (buf_) deallocate(buf_);
+        buf_ = nb;
+        cap_ = newCap;
+        head_ = 0;
+    }
+
+    void reserveFor(std::size_t extra) {
+        std::size_t need = size_ + extra;
+        if (need <= cap_) return;
+        std::size_t c = cap_ ? cap_ : 16;
+        while (c < need) c *= 2;
+        regrow(c);
+    }
+
+public:
+    RingQueue() = default;
+    explicit RingQueue(std::size_t capacity) { reserve(capacity); }
+    ~RingQueue() {
+        clear();
+        if (buf_) deallocate(buf_);
+    }
+
+    RingQueue(const RingQueue& rhs) {
+        reserveFor(rhs.size_);
+        for (std::size_t i = 0; i < rhs.size_; ++i) enqueue(*rhs.slot(i));
+    }
+    RingQueue& operator=(const RingQueue& rhs) {
+        if (this != &rhs) { RingQueue tmp(rhs); swap(tmp); }
+        return *this;
+    }
+    RingQueue(RingQueue&& rhs) noexcept { swap(rhs); }
+    RingQueue& operator=(RingQueue&& rhs) noexcept {
+        if (this != &rhs) { RingQueue tmp(std::move(rhs)); swap(tmp); }
+        return *this;
+    }
+    void swap(RingQueue& o) noexcept {
+        std::swap(buf_, o.buf_);
+        std::swap(cap_, o.cap_);
+        std::swap(head_, o.head_);
+        std::swap(size_, o.size_);
+    }
+
+    bool isEmpty() const { return size_ == 0; }
+    std::size_t getSize() const { return size_; }
+    std::size_t capacity() const { return cap_; }
+
+    // make room for n elements in total without further growth
+    void reserve(std::size_t n) {
+        if (n > size_) reserveFor(n - size_);
+    }
+
+    // destroys the elements, keeps the buffer
+    void clear() {
+        T *a, *b;
+        std::size_t na, nb;
+        runs(a, na, b, nb);
+        destroyRun(a, na);
+        destroyRun(b, nb);
+        head_ = size_ = 0;
+    }
+
+    void enqueue(const T& x) {                  // amortized O(1)
+        if (size_ == cap_) {
+            T tmp(x);   // x may be one of our elements; copy it before regrowing
+            reserveFor(1);
+            ::new (static_cast<void*>(slot(size_))) T(std::move(tmp));
+        } else {
+            ::new (static_cast<void*>(slot(size_))) T(x);
+        }
+        ++size_;
+    }
+    void enqueue(T&& x) {
+        if (size_ == cap_) {
+            T tmp(std::move(x));
+            reserveFor(1);
+            ::new (static_cast<void*>(slot(size_))) T(std::move(tmp));
+        } else {
+            ::new (static_cast<void*>(slot(size_))) T(std::move(x));
+        }
+        ++size_;
+    }
+
+    void dequeue() {                            // O(1)
+        if (isEmpty()) throw std::out_of_range("dequeue on empty queue");
+        buf_[head_].~T();
+        head_ = (head_ + 1) & mask();
+        --size_;
+    }
+
+    // moves the front into out and pops it; false if empty
+    bool try_dequeue(T& out) {
+        if (isEmpty()) return false;
+        out = std::move(buf_[head_]);
+        dequeue();
+        return true;
+    }
+
+    T& front() {
+        if (isEmpty()) throw std::out_of_range("front on empty queue");
+        return buf_[head_];
+    }
+    const T& front() const {
+        if (isEmpty()) throw std::out_of_range("front on empty queue");
+        return buf_[head_];
+    }
+
+    // bulk: append items[0..n), growing at most once. items must not point
+    // into this queue.
+    void enqueue(const T* items, std::size_t n) {
+        reserveFor(n);
+        std::size_t tail = (head_ + size_) & mask();
+        std::size_t first = cap_ - tail < n ? cap_ - tail : n;
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (first) std::memcpy(static_cast<void*>(buf_ + tail), static_cast<const void*>(items), first * sizeof(T));
+            if (n - first) std::memcpy(static_cast<void*>(buf_), static_cast<const void*>(items + first), (n - first) * sizeof(T));
+            size_ += n;
+        } else {
+            for (std::size_t i = 0; i < n; ++i) {
+                ::new (static_cast<void*>(slot(size_))) T(items[i]);
+                ++size_;
+            }
+        }
+    }
+
+    // bulk: move up to max front elements into out[0..), pop them, and
+    // return how many were taken
+    std::size_t dequeue(T* out, std::size_t max) {
+        std::size_t n = size_ < max ? size_ : max;
+        std::size_t first = cap_ - head_ < n ? cap_ - head_ : n;
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (first) std::memcpy(static_cast<void*>(out), static_cast<const void*>(buf_ + head_), first * sizeof(T));
+            if (n - first) std::memcpy(static_cast<void*>(out + first), static_cast<const void*>(buf_), (n - first) * sizeof(T));
+            head_ = (head_ + n) & mask();
+            size_ -= n;
+        } else {
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = std::move(buf_[head_]);
+                dequeue();
+            }
+        }
+        return n;
+    }
+};
+
+#endif
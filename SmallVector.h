@@ -0,0 +1,316 @@
+#pragma once
+// SmallVector.h
+// Vector with the first N elements stored inline: no heap allocation until
+// the N+1st push_back. Supports Vector.h's push/pop/emplace, append, insert,
+// assign, resize, reserve, shrink_to_fit, iteration and byte accounting, and
+// takes the same Growth policy. There is no Storage or Shrink policy: the heap
+// buffer comes from std::allocator and only shrink_to_fit gives memory back.
+#ifndef SMALL_VECTOR_H
+#define SMALL_VECTOR_H
+
+#include "Vector.h"
+#include <algorithm>   // std::rotate
+#include <cstddef>
+#include <cstring>   // std::memcpy
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <class T, std::size_t N, class Growth = DoublingGrowth>
+class SmallVector {
+    static_assert(N > 0, "use Vector<T> for N == 0");
+
+private:
+    alignas(T) unsigned char inline_[N * sizeof(T)];
+    T* data_ = reinterpret_cast<T*>(inline_);
+    std::size_t size_ = 0;
+    std::size_t cap_ = N;
+
+    T* inlineData() { return reinterpret_cast<T*>(inline_); }
+    bool onHeap() const { return data_ != reinterpret_cast<const T*>(inline_); }
+
+    static void destroyRange(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+            for (; first != last; ++first) first->~T();
+    }
+
+    // construct n elements at dst from src (move if that can't throw);
+    // src is left to the caller
+    static void transfer(T* src, std::size_t n, T* dst) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (n) std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        } else {
+            std::size_t i = 0;
+            try {
+                for (; i < n; ++i) ::new (static_cast<void*>(dst + i)) T(std::move_if_noexcept(src[i]));
+            } catch (...) {
+                destroyRange(dst, dst + i);
+                throw;
+            }
+        }
+    }
+
+    void freeHeap() {
+        if (onHeap()) std::allocator<T>().deallocate(data_, cap_);
+    }
+
+    // Spill to (or move between) heap buffers of newCap slots, leaving a
+    // gap of count slots at index at that build(p) fills. build runs before
+    // anything is moved, so it may copy from our own elements.
+    template <class Build>
+    void reallocateWith(std::size_t newCap, std::size_t at, std::size_t count, Build build) {
+        T* nd = std::allocator<T>().allocate(newCap);
+        std::size_t done = 0;   // 0: nothing, 1: gap built, 2: head moved
+        try {
+            build(nd + at);
+            done = 1;
+            transfer(data_, at, nd);
+            done = 2;
+            transfer(data_ + at, size_ - at, nd + at + count);
+        } catch (...) {
+            if (done == 2) destroyRange(nd, nd + at);
+            if (done >= 1) destroyRange(nd + at, nd + at + count);
+            std::allocator<T>().deallocate(nd, newCap);
+            throw;
+        }
+        destroyRange(data_, data_ + size_);
+        freeHeap();
+        data_ = nd;
+        size_ += count;
+        cap_ = newCap;
+    }
+    void reallocate(std::size_t newCap) {
+        reallocateWith(newCap, size_, 0, [](T*) {});
+    }
+
+    template <class It>
+    static constexpr bool isForward() {
+        return std::is_base_of<std::forward_iterator_tag,
+                               typename std::iterator_traits<It>::iterator_category>::value;
+    }
+
+    void growIfNeeded(std::size_t minCap) {
+        if (cap_ >= minCap) return;
+        reallocate(Growth::nextCapacity(cap_, minCap));
+    }
+
+    template <class... Args>
+    [[gnu::noinline]] void growAndEmplace(Args&&... args) {
+        T tmp(std::forward<Args>(args)...);   // args may refer to our own elements
+        growIfNeeded(size_ + 1);
+        ::new (static_cast<void*>(data_ + size_)) T(std::move(tmp));
+        ++size_;
+    }
+
+    // take rhs's elements: steal its heap buffer, or move the inline ones
+    void stealFrom(SmallVector& rhs) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (rhs.onHeap()) {
+            data_ = rhs.data_; size_ = rhs.size_; cap_ = rhs.cap_;
+            rhs.data_ = rhs.inlineData(); rhs.size_ = 0; rhs.cap_ = N;
+        } else {
+            transfer(rhs.data_, rhs.size_, data_);
+            size_ = rhs.size_;
+            rhs.clear();
+        }
+    }
+
+    void release() {
+        destroyRange(data_, data_ + size_);
+        freeHeap();
+        data_ = inlineData(); size_ = 0; cap_ = N;
+    }
+
+public:
+    SmallVector() = default;
+    SmallVector(std::initializer_list<T> il) { append(il); }
+    ~SmallVector() { release(); }
+
+    // copy/move
+    SmallVector(const SmallVector& rhs) { append(rhs.begin(), rhs.end()); }
+    SmallVector& operator=(const SmallVector& rhs) {
+        if (this != &rhs) { clear(); append(rhs.begin(), rhs.end()); }
+        return *this;
+    }
+    SmallVector(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        stealFrom(rhs);
+    }
+    SmallVector& operator=(SmallVector&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value) {
+        if (this != &rhs) { release(); stealFrom(rhs); }
+        return *this;
+    }
+
+    // basic queries
+    std::size_t size()     const { return size_; }
+    bool        empty()    const { return size_ == 0; }
+    std::size_t capacity() const { return cap_; }
+    bool        isSmall()  const { return !onHeap(); }   // still using the inline buffer
+
+    // memory accounting as in Vector; while small the retained bytes are
+    // the inline buffer
+    std::size_t bytesUsed()     const { return size_ * sizeof(T); }
+    std::size_t bytesRetained() const { return cap_ * sizeof(T); }
+
+    // element access
+    T& operator[](std::size_t i) { return data_[i]; }
+    const T& operator[](std::size_t i) const { return data_[i]; }
+
+    T& at(std::size_t i) {
+        if (i >= size_) throw std::out_of_range("at");
+        return data_[i];
+    }
+    const T& at(std::size_t i) const {
+        if (i >= size_) throw std::out_of_range("at");
+        return data_[i];
+    }
+
+    // iteration helpers
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+    T* begin() { return data_; }
+    T* end() { return data_ + size_; }
+    const T* begin() const { return data_; }
+    const T* end()   const { return data_ + size_; }
+
+    // modifiers
+    void push_back(const T& x) { emplace_back(x); }
+    void push_back(T&& x) { emplace_back(std::move(x)); }
+
+    template <class... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == cap_) growAndEmplace(std::forward<Args>(args)...);
+        else {
+            ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+            ++size_;
+        }
+        return data_[size_ - 1];
+    }
+
+    void reserve(std::size_t n) {
+        if (n > cap_) reallocate(n);
+    }
+
+    // append [first, last); reserves once for forward iterators
+    template <class It, typename std::enable_if<!std::is_integral<It>::value, int>::type = 0>
+    void append(It first, It last) {
+        if constexpr (isForward<It>()) {
+            std::size_t n = (std::size_t)std::distance(first, last);
+            if (size_ + n > cap_) {
+                reallocateWith(Growth::nextCapacity(cap_, size_ + n), size_, n, [&](T* p) {
+                    std::uninitialized_copy(first, last, p);
+                });
+                return;
+            }
+            std::uninitialized_copy(first, last, data_ + size_);
+            size_ += n;
+        } else {
+            for (; first != last; ++first) emplace_back(*first);
+        }
+    }
+    void append(std::initializer_list<T> il) { append(il.begin(), il.end()); }
+
+    // insert [first, last) before index pos (0..size())
+    template <class It, typename std::enable_if<!std::is_integral<It>::value, int>::type = 0>
+    void insert(std::size_t pos, It first, It last) {
+        if (pos > size_) throw std::out_of_range("insert");
+        if constexpr (isForward<It>()) {
+            std::size_t n = (std::size_t)std::distance(first, last);
+            if (size_ + n > cap_) {
+                reallocateWith(Growth::nextCapacity(cap_, size_ + n), pos, n, [&](T* p) {
+                    std::uninitialized_copy(first, last, p);
+                });
+                return;
+            }
+        }
+        // room already (or unknown length): append, then rotate into place
+        std::size_t oldSize = size_;
+        append(first, last);
+        std::rotate(data_ + pos, data_ + oldSize, data_ + size_);
+    }
+    void insert(std::size_t pos, std::initializer_list<T> il) { insert(pos, il.begin(), il.end()); }
+
+    // replace the contents with [first, last)
+    template <class It, typename std::enable_if<!std::is_integral<It>::value, int>::type = 0>
+    void assign(It first, It last) {
+        if constexpr (isForward<It>()) {
+            std::size_t n = (std::size_t)std::distance(first, last);
+            if (n > cap_) {
+                SmallVector tmp;
+                tmp.reallocateWith(n, 0, n, [&](T* p) { std::uninitialized_copy(first, last, p); });
+                *this = std::move(tmp);
+            } else if (n <= size_) {
+                std::copy(first, last, data_);        // the range may be our own tail
+                destroyRange(data_ + n, data_ + size_);
+                size_ = n;
+            } else {
+                It mid = first;
+                std::advance(mid, size_);
+                std::copy(first, mid, data_);
+                std::uninitialized_copy(mid, last, data_ + size_);
+                size_ = n;
+            }
+        } else {
+            clear();
+            append(first, last);
+        }
+    }
+    void assign(std::initializer_list<T> il) { assign(il.begin(), il.end()); }
+    void assign(std::size_t n, const T& value) {
+        if (n > cap_) {
+            SmallVector tmp;
+            tmp.reallocateWith(n, 0, n, [&](T* p) { std::uninitialized_fill_n(p, n, value); });
+            *this = std::move(tmp);
+        } else {
+            T v(value);                               // value may be one of ours
+            std::size_t common = (n < size_) ? n : size_;
+            std::fill_n(data_, common, v);
+            if (n > size_) std::uninitialized_fill_n(data_ + size_, n - size_, v);
+            else destroyRange(data_ + n, data_ + size_);
+            size_ = n;
+        }
+    }
+
+    void resize(std::size_t n, const T& value) {
+        if (n <= size_) { destroyRange(data_ + n, data_ + size_); size_ = n; return; }
+        T v(value);
+        growIfNeeded(n);
+        std::uninitialized_fill_n(data_ + size_, n - size_, v);
+        size_ = n;
+    }
+    void resize(std::size_t n) {
+        if (n <= size_) { destroyRange(data_ + n, data_ + size_); size_ = n; return; }
+        growIfNeeded(n);
+        std::uninitialized_value_construct_n(data_ + size_, n - size_);
+        size_ = n;
+    }
+
+    void pop_back() {
+        if (size_ == 0) throw std::out_of_range("pop_back on empty vector");
+        --size_;
+        data_[size_].~T();
+    }
+    void clear() {                      // leave capacity alone
+        destroyRange(data_, data_ + size_);
+        size_ = 0;
+    }
+
+    // move back into the inline buffer if we fit, else trim the heap buffer
+    void shrink_to_fit() {
+        if (!onHeap() || size_ == cap_) return;
+        if (size_ <= N) {
+            T* old = data_;
+            std::size_t oldCap = cap_;
+            transfer(old, size_, inlineData());
+            destroyRange(old, old + size_);
+            std::allocator<T>().deallocate(old, oldCap);
+            data_ = inlineData(); cap_ = N;
+        } else {
+            reallocate(size_);
+        }
+    }
+};
+
+#endif
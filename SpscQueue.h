@@ -0,0 +1,158 @@
+#pragma once
+// SpscQueue.h
+// Bounded lock-free FIFO for exactly one producer thread and one consumer
+// thread. A power-of-two ring of slots with two monotonically increasing
+// indices: the producer only writes tail_, the consumer only writes head_,
+// each on its own cache line. Each side also keeps a cached copy of the
+// other's index, so the shared line is only read when the cached value
+// says the ring looks full (or empty).
+//
+// try_enqueue/try_dequeue never block; enqueue/dequeue yield until they
+// succeed. The batch forms move a run of items with one index publish.
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <stdexcept>
+#include <thread>    // std::this_thread::yield
+#include <type_traits>
+#include <utility>
+
+template <class T>
+class SpscQueue {
+private:
+    static constexpr std::size_t kCacheLine = 64;
+
+    static std::size_t roundUp(std::size_t n) {
+        std::size_t c = 2;
+        while (c < n) c *= 2;
+        return c;
+    }
+
+    // read-only after construction
+    T* buf_;
+    std::size_t mask_;
+
+    // consumer side
+    alignas(kCacheLine) std::atomic<std::size_t> head_{0};
+    std::size_t tailCache_ = 0;
+
+    // producer side
+    alignas(kCacheLine) std::atomic<std::size_t> tail_{0};
+    std::size_t headCache_ = 0;
+    // (the class is cache-line aligned, so nothing else lands on this line)
+
+    T* slot(std::size_t i) const { return buf_ + (i & mask_); }
+    std::size_t cap() const { return mask_ + 1; }
+
+    // producer: slots free from t, refreshing the cached head only if needed
+    std::size_t freeFrom(std::size_t t, std::size_t want) {
+        std::size_t room = cap() - (t - headCache_);
+        if (room < want) {
+            headCache_ = head_.load(std::memory_order_acquire);
+            room = cap() - (t - headCache_);
+        }
+        return room;
+    }
+    // consumer: items ready from h, refreshing the cached tail only if needed
+    std::size_t readyFrom(std::size_t h, std::size_t want) {
+        std::size_t avail = tailCache_ - h;
+        if (avail < want) {
+            tailCache_ = tail_.load(std::memory_order_acquire);
+            avail = tailCache_ - h;
+        }
+        return avail;
+    }
+
+public:
+    // capacity is rounded up to a power of two
+    explicit SpscQueue(std::size_t capacity) {
+        if (capacity == 0) throw std::invalid_argument("SpscQueue capacity must be positive");
+        std::size_t c = roundUp(capacity);
+        mask_ = c - 1;
+        if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__)
+            buf_ = static_cast<T*>(::operator new(c * sizeof(T), std::align_val_t(alignof(T))));
+        else
+            buf_ = static_cast<T*>(::operator new(c * sizeof(T)));
+    }
+    SpscQueue(const SpscQueue&) = delete;
+    SpscQueue& operator=(const SpscQueue&) = delete;
+
+    // neither thread may be using the queue while destroying
+    ~SpscQueue() {
+        std::size_t t = tail_.load(std::memory_order_relaxed);
+        for (std::size_t h = head_.load(std::memory_order_relaxed); h != t; ++h) slot(h)->~T();
+        if (alignof(T) > __STDCPP_DEFAULT_NEW_ALIGNMENT__) ::operator delete(buf_, std::align_val_t(alignof(T)));
+        else ::operator delete(buf_);
+    }
+
+    std::size_t capacity() const { return cap(); }
+    // a snapshot; exact only when called from one side while the other is idle
+    std::size_t getSize() const {
+        std::size_t h = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - h;
+    }
+    bool isEmpty() const { return getSize() == 0; }
+
+    // producer only
+    bool try_enqueue(const T& x) {
+        std::size_t t = tail_.load(std::memory_order_relaxed);
+        if (freeFrom(t, 1) == 0) return false;
+        ::new (static_cast<void*>(slot(t))) T(x);
+        tail_.store(t + 1, std::memory_order_release);
+        return true;
+    }
+    bool try_enqueue(T&& x) {
+        std::size_t t = tail_.load(std::memory_order_relaxed);
+        if (freeFrom(t, 1) == 0) return false;
+        ::new (static_cast<void*>(slot(t))) T(std::move(x));
+        tail_.store(t + 1, std::memory_order_release);
+        return true;
+    }
+    void enqueue(const T& x) {
+        while (!try_enqueue(x)) std::this_thread::yield();
+    }
+    void enqueue(T&& x) {
+        while (!try_enqueue(std::move(x))) std::this_thread::yield();
+    }
+    // copies as many of items[0..n) as fit; returns how many
+    std::size_t try_enqueue(const T* items, std::size_t n) {
+        std::size_t t = tail_.load(std::memory_order_relaxed);
+        std::size_t room = freeFrom(t, n);
+        if (n > room) n = room;
+        for (std::size_t i = 0; i < n; ++i) ::new (static_cast<void*>(slot(t + i))) T(items[i]);
+        if (n) tail_.store(t + n, std::memory_order_release);
+        return n;
+    }
+
+    // consumer only
+    bool try_dequeue(T& out) {
+        std::size_t h = head_.load(std::memory_order_relaxed);
+        if (readyFrom(h, 1) == 0) return false;
+        T* p = slot(h);
+        out = std::move(*p);
+        p->~T();
+        head_.store(h + 1, std::memory_order_release);
+        return true;
+    }
+    void dequeue(T& out) {
+        while (!try_dequeue(out)) std::this_thread::yield();
+    }
+    // moves up to max items into out[0..); returns how many
+    std::size_t try_dequeue(T* out, std::size_t max) {
+        std::size_t h = head_.load(std::memory_order_relaxed);
+        std::size_t n = readyFrom(h, max);
+        if (n > max) n = max;
+        for (std::size_t i = 0; i < n; ++i) {
+            T* p = slot(h + i);
+            out[i] = std::move(*p);
+            p->~T();
+        }
+        if (n) head_.store(h + n, std::memory_order_release);
+        return n;
+    }
+};
+
+#endif
@@ -7,10 +7,10 @@
 #include <stdexcept>
 #include <cstddef>
 
-template <class T>
+template <class T, class NodeAlloc = NewNodeAlloc>
 class Stack {
 private:
-    LinkedList<T> data;   // top of stack is position 1
+    LinkedList<T, NodeAlloc> data;   // top of stack is position 1
 
 public:
     bool isEmpty() const { return data.getLength() == 0; }
@@ -18,21 +18,21 @@ public:
     void clear() { data.clear(); }
 
     void push(const T& x) {               // O(1)
-        data.insert(1, x);
+        data.push_front(x);
     }
 
     void pop() {                          // O(1)
         if (isEmpty()) throw std::out_of_range("pop on empty stack");
-        data.remove(1);
+        data.pop_front();
     }
 
     T& top() {
         if (isEmpty()) throw std::out_of_range("top on empty stack");
-        return data.getEntry(1);
+        return data.front();
     }
     const T& top() const {
         if (isEmpty()) throw std::out_of_range("top on empty stack");
-        return data.getEntry(1);
+        return data.front();
     }
 };
 
@@ -0,0 +1,264 @@
+#pragma once
+// UnrolledList.h
+// ListInterface implementation whose nodes each hold a contiguous block of
+// up to BlockSize elements. Each block knows its count, so finding position
+// i skips whole blocks (about n / BlockSize hops instead of n), and a scan
+// touches one cache line per few elements instead of one per element.
+// A full block splits in half on insert; a block that drops below half full
+// on remove absorbs its successor when both fit in one block.
+#ifndef UNROLLED_LIST_H
+#define UNROLLED_LIST_H
+
+#include "ListInterface.h"
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+template <class T, std::size_t BlockSize = 64>
+class UnrolledList : public ListInterface<T> {
+    static_assert(BlockSize >= 2, "BlockSize must be at least 2");
+
+private:
+    struct Block {
+        Block* prev = nullptr;
+        Block* next = nullptr;
+        std::size_t count = 0;
+        alignas(T) unsigned char buf[BlockSize * sizeof(T)];
+
+        T* elems() { return std::launder(reinterpret_cast<T*>(buf)); }
+        const T* elems() const { return std::launder(reinterpret_cast<const T*>(buf)); }
+        T& operator[](std::size_t i) { return elems()[i]; }
+        const T& operator[](std::size_t i) const { return elems()[i]; }
+
+        ~Block() {
+            for (std::size_t i = 0; i < count; ++i) elems()[i].~T();
+        }
+    };
+
+    Block* head = nullptr;
+    Block* tail = nullptr;
+    size_t sz = 0;
+    size_t blocks = 0;
+
+    // block and offset holding 1-based pos (1..sz); walks from whichever
+    // end is nearer, a block at a time
+    struct Where {
+        Block* block;
+        std::size_t index;
+    };
+    Where locate(size_t pos) const {
+        if (pos < 1 || pos > sz) throw std::out_of_range("invalid pos");
+        std::size_t i = pos - 1;
+        if (i < sz / 2) {
+            Block* b = head;
+            while (i >= b->count) { i -= b->count; b = b->next; }
+            return Where{b, i};
+        }
+        std::size_t fromBack = sz - 1 - i;
+        Block* b = tail;
+        while (fromBack >= b->count) { fromBack -= b->count; b = b->prev; }
+        return Where{b, b->count - 1 - fromBack};
+    }
+
+    Block* newBlockAfter(Block* b) {
+        Block* n = new Block;
+        n->prev = b;
+        n->next = b ? b->next : head;
+        if (n->next) n->next->prev = n;
+        else         tail = n;
+        if (b) b->next = n;
+        else   head = n;
+        ++blocks;
+        return n;
+    }
+    void unlink(Block* b) {
+        if (b->prev) b->prev->next = b->next;
+        else         head = b->next;
+        if (b->next) b->next->prev = b->prev;
+        else         tail = b->prev;
+        delete b;
+        --blocks;
+    }
+
+    // move the upper half of a full block into a fresh block after it
+    Block* split(Block* b) {
+        Block* n = newBlockAfter(b);
+        std::size_t keep = b->count / 2;
+        for (std::size_t j = keep; j < b->count; ++j) {
+            ::new (static_cast<void*>(n->elems() + n->count)) T(std::move((*b)[j]));
+            ++n->count;
+        }
+        for (std::size_t j = keep; j < b->count; ++j) (*b)[j].~T();
+        b->count = keep;
+        return n;
+    }
+
+    // pull every element of b->next into b and drop the emptied block
+    void mergeNext(Block* b) {
+        Block* n = b->next;
+        for (std::size_t j = 0; j < n->count; ++j) {
+            ::new (static_cast<void*>(b->elems() + b->count)) T(std::move((*n)[j]));
+            ++b->count;
+        }
+        unlink(n);
+    }
+
+    void copyFrom(const UnrolledList& other) {
+        for (const Block* b = other.head; b; b = b->next) {
+            Block* n = newBlockAfter(tail);
+            for (std::size_t j = 0; j < b->count; ++j) {
+                ::new (static_cast<void*>(n->elems() + j)) T((*b)[j]);
+                ++n->count;
+                ++sz;
+            }
+        }
+    }
+
+    // forward iterator; Ref/Ptr pick mutable vs const
+    template <class Ref, class Ptr>
+    class Iter {
+    private:
+        friend class UnrolledList;
+        template <class, class> friend class Iter;
+        Block* block = nullptr;
+        std::size_t index = 0;
+        Iter(Block* b, std::size_t i) : block(b), index(i) {}
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using reference         = Ref;
+        using pointer           = Ptr;
+
+        Iter() = default;
+        template <class R2, class P2,
+                  class = typename std::enable_if<std::is_convertible<P2, Ptr>::value>::type>
+        Iter(const Iter<R2, P2>& o) : block(o.block), index(o.index) {}
+
+        Ref operator*() const { return (*block)[index]; }
+        Ptr operator->() const { return &(*block)[index]; }
+        Iter& operator++() {
+            if (++index == block->count) { block = block->next; index = 0; }
+            return *this;
+        }
+        Iter operator++(int) { Iter t = *this; ++*this; return t; }
+        friend bool operator==(const Iter& a, const Iter& b) {
+            return a.block == b.block && a.index == b.index;
+        }
+        friend bool operator!=(const Iter& a, const Iter& b) { return !(a == b); }
+    };
+
+public:
+    using iterator       = Iter<T&, T*>;
+    using const_iterator = Iter<const T&, const T*>;
+
+    UnrolledList() = default;
+    ~UnrolledList() override { clear(); }
+
+    UnrolledList(const UnrolledList& rhs) {
+        try { copyFrom(rhs); } catch (...) { clear(); throw; }
+    }
+    UnrolledList& operator=(const UnrolledList& rhs) {
+        if (this != &rhs) { UnrolledList tmp(rhs); *this = std::move(tmp); }
+        return *this;
+    }
+
+    UnrolledList(UnrolledList&& rhs) noexcept
+        : head(rhs.head), tail(rhs.tail), sz(rhs.sz), blocks(rhs.blocks) {
+        rhs.head = rhs.tail = nullptr; rhs.sz = rhs.blocks = 0;
+    }
+    UnrolledList& operator=(UnrolledList&& rhs) noexcept {
+        if (this != &rhs) {
+            clear();
+            head = rhs.head; tail = rhs.tail; sz = rhs.sz; blocks = rhs.blocks;
+            rhs.head = rhs.tail = nullptr; rhs.sz = rhs.blocks = 0;
+        }
+        return *this;
+    }
+
+    bool   isEmpty() const override { return sz == 0; }
+    size_t getLength() const override { return sz; }
+    size_t blockCount() const { return blocks; }
+
+    bool insert(size_t pos, const T& entry) override {
+        if (pos < 1 || pos > sz + 1) return false;
+        T tmp(entry);   // entry may live in this list and move during the shift
+
+        Block* b;
+        std::size_t i;
+        if (pos == sz + 1) {
+            // appending to a full tail starts a new block rather than
+            // splitting, so a list built by appends stays packed
+            b = (tail && tail->count < BlockSize) ? tail : newBlockAfter(tail);
+            i = b->count;
+        } else {
+            Where w = locate(pos);
+            b = w.block; i = w.index;
+        }
+        if (b->count == BlockSize) {
+            Block* n = split(b);
+            if (i > b->count) { i -= b->count; b = n; }
+        }
+
+        T* e = b->elems();
+        if (i == b->count) {
+            ::new (static_cast<void*>(e + i)) T(std::move(tmp));
+        } else {
+            ::new (static_cast<void*>(e + b->count)) T(std::move(e[b->count - 1]));
+            for (std::size_t j = b->count - 1; j > i; --j) e[j] = std::move(e[j - 1]);
+            e[i] = std::move(tmp);
+        }
+        ++b->count;
+        ++sz; return true;
+    }
+
+    bool remove(size_t pos) override {
+        if (pos < 1 || pos > sz) return false;
+        Where w = locate(pos);
+        Block* b = w.block;
+        T* e = b->elems();
+        for (std::size_t j = w.index; j + 1 < b->count; ++j) e[j] = std::move(e[j + 1]);
+        e[b->count - 1].~T();
+        --b->count;
+        --sz;
+
+        if (b->count == 0) unlink(b);
+        else if (b->count < BlockSize / 2 && b->next && b->count + b->next->count <= BlockSize)
+            mergeNext(b);
+        return true;
+    }
+
+    void clear() override {
+        while (head) { Block* b = head; head = head->next; delete b; }
+        tail = nullptr;
+        sz = blocks = 0;
+    }
+
+    T& getEntry(size_t pos) override {
+        Where w = locate(pos);
+        return (*w.block)[w.index];
+    }
+    const T& getEntry(size_t pos) const override {
+        Where w = locate(pos);
+        return (*w.block)[w.index];
+    }
+
+    bool replace(size_t pos, const T& entry) override {
+        if (pos < 1 || pos > sz) return false;
+        getEntry(pos) = entry; return true;
+    }
+
+    // iteration
+    iterator begin() { return iterator(head, 0); }
+    iterator end() { return iterator(nullptr, 0); }
+    const_iterator begin() const { return const_iterator(head, 0); }
+    const_iterator end() const { return const_iterator(nullptr, 0); }
+    const_iterator cbegin() const { return const_iterator(head, 0); }
+    const_iterator cend() const { return const_iterator(nullptr, 0); }
+};
+
+#endif
@@ -4,20 +4,10 @@
 #define VECTOR_COPY_ALGO_H
 
 #include "Vector.h"
-#include <algorithm> // std::copy
 
+// Used to override growIfNeeded with std::copy. Relocation now lives in
+// Vector itself (memcpy / move_if_noexcept), so this is plain doubling.
 template <class T>
-class VectorCopyAlgo : public Vector<T> {
-protected:
-    void growIfNeeded(std::size_t minCap) override {
-        if (this->cap_ >= minCap) return;
-        std::size_t newCap = this->nextCapacity(minCap);
-        T* nd = new T[newCap];
-        std::copy(this->data_, this->data_ + this->size_, nd);
-        delete[] this->data_;
-        this->data_ = nd;
-        this->cap_ = newCap;
-    }
-};
+using VectorCopyAlgo = Vector<T, DoublingGrowth>;
 
 #endif
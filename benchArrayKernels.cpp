@@ -0,0 +1,81 @@
+// benchArrayKernels.cpp
+// ArrayKernels on AlignedArray vs the hand-written loops we use on Array.
+// build: g++ -std=c++17 -O2 -mavx2 -mfma benchArrayKernels.cpp
+// (without -m flags the kernels use SSE2)
+#include "Array.h"
+#include "AlignedArray.h"
+#include "ArrayKernels.h"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+template <class F>
+double timeReps(std::size_t reps, F f) {
+    auto t0 = clock_type::now();
+    for (std::size_t r = 0; r < reps; ++r) f(r);
+    return std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+}
+
+// keep results alive without a data dependency the compiler can drop
+template <class T>
+void sink(const T& x) { asm volatile("" : : "g"(&x) : "memory"); }
+
+template <class T, std::size_t N>
+void run(const char* label, std::size_t reps) {
+    namespace K = ArrayKernels;
+    Array<T, N> na, nb, nc, nout;
+    AlignedArray<T, N> a, b, c, out;
+    for (std::size_t i = 0; i < N; ++i) {
+        na[i] = a[i] = (T)(i % 13);
+        nb[i] = b[i] = (T)(i % 7 + 1);
+        nc[i] = c[i] = (T)1;
+    }
+
+    double naive, kern;
+    std::cout << "[" << label << " N=" << N << " reps=" << reps << "]\n";
+
+    naive = timeReps(reps, [&](std::size_t) {
+        for (std::size_t i = 0; i < N; ++i) nout[i] = na[i] * nb[i] + nc[i];
+        sink(nout);
+    });
+    kern = timeReps(reps, [&](std::size_t) { K::fma(a, b, c, out); sink(out); });
+    std::cout << "  fma    naive ms=" << naive << "  kernel ms=" << kern << "\n";
+
+    T s1 = 0, s2 = 0;
+    naive = timeReps(reps, [&](std::size_t) {
+        T s = 0;
+        for (std::size_t i = 0; i < N; ++i) s += na[i] * nb[i];
+        s1 += s; sink(s1);
+    });
+    kern = timeReps(reps, [&](std::size_t) { s2 += K::dot(a, b); sink(s2); });
+    std::cout << "  dot    naive ms=" << naive << "  kernel ms=" << kern << "\n";
+
+    naive = timeReps(reps, [&](std::size_t) {
+        T m = na[0];
+        for (std::size_t i = 1; i < N; ++i) if (na[i] > m) m = na[i];
+        s1 += m; sink(s1);
+    });
+    kern = timeReps(reps, [&](std::size_t) { s2 += K::maxOf(a); sink(s2); });
+    std::cout << "  maxOf  naive ms=" << naive << "  kernel ms=" << kern << "\n";
+
+    std::size_t c1 = 0, c2 = 0;
+    Array<bool, N> nmask;
+    naive = timeReps(reps, [&](std::size_t) {
+        for (std::size_t i = 0; i < N; ++i) nmask[i] = na[i] < nb[i];
+        sink(nmask);
+        for (std::size_t i = 0; i < N; ++i) c1 += nmask[i];
+    });
+    kern = timeReps(reps, [&](std::size_t) { c2 += K::less(a, b).count(); sink(c2); });
+    std::cout << "  less   naive ms=" << naive << "  kernel ms=" << kern
+              << (c1 == c2 ? "" : "  MISMATCH") << "\n";
+}
+
+int main() {
+    run<float, 1024>("float", 200000);
+    run<double, 1024>("double", 100000);
+    run<std::int32_t, 1024>("int32", 200000);
+    return 0;
+}
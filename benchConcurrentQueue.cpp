@@ -0,0 +1,150 @@
+// benchConcurrentQueue.cpp
+// Throughput and round-trip latency of SpscQueue and MpmcQueue against a
+// Queue behind one mutex (bounded to the same capacity, so every variant
+// applies the same back-pressure). Single items and batches of 32.
+// build: g++ -std=c++17 -O2 -pthread benchConcurrentQueue.cpp
+#include "Queue.h"
+#include "SpscQueue.h"
+#include "MpmcQueue.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+// the baseline: today's Queue with a lock around it
+template <class T>
+class LockedQueue {
+private:
+    std::mutex lock;
+    Queue<T> q;
+    std::size_t cap;
+
+public:
+    explicit LockedQueue(std::size_t capacity) : cap(capacity) {}
+    bool try_enqueue(const T& x) {
+        std::lock_guard<std::mutex> g(lock);
+        if (q.getSize() == cap) return false;
+        q.enqueue(x);
+        return true;
+    }
+    bool try_dequeue(T& out) {
+        std::lock_guard<std::mutex> g(lock);
+        if (q.isEmpty()) return false;
+        out = q.front();
+        q.dequeue();
+        return true;
+    }
+    std::size_t try_enqueue(const T* items, std::size_t n) {
+        std::lock_guard<std::mutex> g(lock);
+        std::size_t k = 0;
+        for (; k < n && q.getSize() < cap; ++k) q.enqueue(items[k]);
+        return k;
+    }
+    std::size_t try_dequeue(T* out, std::size_t max) {
+        std::lock_guard<std::mutex> g(lock);
+        std::size_t k = 0;
+        for (; k < max && !q.isEmpty(); ++k) { out[k] = q.front(); q.dequeue(); }
+        return k;
+    }
+};
+
+// P producers push perProducer items each, C consumers drain them all.
+// batch == 1 uses the single-item calls.
+template <class Q>
+void throughput(const char* label, std::size_t P, std::size_t C, std::size_t perProducer, std::size_t batch) {
+    Q q(1024);
+    const long long total = (long long)(P * perProducer);
+    std::atomic<long long> taken{0}, sum{0};
+    std::vector<std::thread> ts;
+    auto t0 = clock_type::now();
+    for (std::size_t p = 0; p < P; ++p)
+        ts.emplace_back([&q, perProducer, batch] {
+            std::vector<long long> buf(batch);
+            for (std::size_t i = 0; i < perProducer;) {
+                if (batch == 1) {
+                    while (!q.try_enqueue((long long)i)) std::this_thread::yield();
+                    ++i;
+                    continue;
+                }
+                std::size_t k = 0;
+                for (; k < batch && i + k < perProducer; ++k) buf[k] = (long long)(i + k);
+                for (std::size_t done = 0; done < k;) {
+                    std::size_t n = q.try_enqueue(buf.data() + done, k - done);
+                    if (!n) std::this_thread::yield();
+                    done += n;
+                }
+                i += k;
+            }
+        });
+    for (std::size_t c = 0; c < C; ++c)
+        ts.emplace_back([&q, &taken, &sum, total, batch] {
+            std::vector<long long> buf(batch);
+            long long local = 0;
+            while (taken.load(std::memory_order_relaxed) < total) {
+                std::size_t n = batch == 1 ? (q.try_dequeue(buf[0]) ? 1 : 0)
+                                           : q.try_dequeue(buf.data(), batch);
+                if (!n) { std::this_thread::yield(); continue; }
+                for (std::size_t j = 0; j < n; ++j) local += buf[j];
+                taken.fetch_add((long long)n, std::memory_order_relaxed);
+            }
+            sum += local;
+        });
+    for (auto& t : ts) t.join();
+    double s = std::chrono::duration<double>(clock_type::now() - t0).count();
+    long long expect = (long long)P * ((long long)perProducer * ((long long)perProducer - 1) / 2);
+    std::printf("  %-34s %8.2f M items/s%s\n", label, total / s / 1e6, sum == expect ? "" : "  CHECKSUM MISMATCH");
+}
+
+// ping-pong: one thread sends, the other echoes back; mean round trip
+template <class Q>
+void latency(const char* label, std::size_t trips) {
+    Q there(64), back(64);
+    std::thread echo([&] {
+        long long x;
+        for (std::size_t i = 0; i < trips; ++i) {
+            while (!there.try_dequeue(x)) std::this_thread::yield();
+            while (!back.try_enqueue(x)) std::this_thread::yield();
+        }
+    });
+    auto t0 = clock_type::now();
+    long long x;
+    for (std::size_t i = 0; i < trips; ++i) {
+        while (!there.try_enqueue((long long)i)) std::this_thread::yield();
+        while (!back.try_dequeue(x)) std::this_thread::yield();
+    }
+    double ns = std::chrono::duration<double, std::nano>(clock_type::now() - t0).count();
+    echo.join();
+    std::printf("  %-34s %8.0f ns/round trip\n", label, ns / trips);
+}
+
+int main() {
+    const std::size_t n = 2000000;
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    std::printf("1 producer / 1 consumer, single items\n");
+    throughput<LockedQueue<long long>>("mutex + Queue", 1, 1, n, 1);
+    throughput<SpscQueue<long long>>("SpscQueue", 1, 1, n, 1);
+    throughput<MpmcQueue<long long>>("MpmcQueue", 1, 1, n, 1);
+
+    std::printf("1 producer / 1 consumer, batches of 32\n");
+    throughput<LockedQueue<long long>>("mutex + Queue", 1, 1, n, 32);
+    throughput<SpscQueue<long long>>("SpscQueue", 1, 1, n, 32);
+    throughput<MpmcQueue<long long>>("MpmcQueue", 1, 1, n, 32);
+
+    std::printf("4 producers / 4 consumers\n");
+    throughput<LockedQueue<long long>>("mutex + Queue", 4, 4, n / 4, 1);
+    throughput<MpmcQueue<long long>>("MpmcQueue", 4, 4, n / 4, 1);
+    throughput<LockedQueue<long long>>("mutex + Queue, batch 32", 4, 4, n / 4, 32);
+    throughput<MpmcQueue<long long>>("MpmcQueue, batch 32", 4, 4, n / 4, 32);
+
+    std::printf("round-trip latency\n");
+    latency<LockedQueue<long long>>("mutex + Queue", 20000);
+    latency<SpscQueue<long long>>("SpscQueue", 20000);
+    latency<MpmcQueue<long long>>("MpmcQueue", 20000);
+    return 0;
+}
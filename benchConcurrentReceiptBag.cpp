@@ -0,0 +1,68 @@
+// benchConcurrentReceiptBag.cpp
+// Contention benchmark: T threads each issue and redeem receipts in
+// batches (insert 64, remove those 64, repeat). One ReceiptBag behind a
+// single mutex vs ConcurrentReceiptBag with 16 and 64 shards.
+// build: g++ -std=c++17 -O2 -pthread benchConcurrentReceiptBag.cpp
+#include "ReceiptBag.h"
+#include "ConcurrentReceiptBag.h"
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// the baseline: ReceiptBag with one lock around everything
+template <class T>
+class LockedReceiptBag {
+private:
+    std::mutex lock;
+    ReceiptBag<T> bag;
+
+public:
+    using Receipt = typename ReceiptBag<T>::Receipt;
+    Receipt insert(const T& x) { std::lock_guard<std::mutex> g(lock); return bag.insert(x); }
+    T remove(Receipt r) { std::lock_guard<std::mutex> g(lock); return bag.remove(r); }
+};
+
+template <class Bag>
+double run(std::size_t threads, std::size_t opsPerThread) {
+    using clock = std::chrono::high_resolution_clock;
+    Bag bag;
+    std::atomic<long long> checksum{0};
+    std::vector<std::thread> pool;
+    auto t0 = clock::now();
+    for (std::size_t t = 0; t < threads; ++t) {
+        pool.emplace_back([&bag, &checksum, opsPerThread, t] {
+            typename Bag::Receipt batch[64];
+            long long sum = 0;
+            for (std::size_t done = 0; done < opsPerThread; done += 128) {
+                for (int i = 0; i < 64; ++i) batch[i] = bag.insert((int)(t + i));
+                for (int i = 0; i < 64; ++i) sum += bag.remove(batch[i]);
+            }
+            checksum += sum;
+        });
+    }
+    for (auto& th : pool) th.join();
+    long long want = 0;
+    for (std::size_t t = 0; t < threads; ++t) want += (long long)(opsPerThread / 128) * (64 * (long long)t + 2016);
+    if (checksum != want) std::cout << "  MISMATCH\n";
+    return std::chrono::duration<double, std::milli>(clock::now() - t0).count();
+}
+
+int main() {
+    const std::size_t ops = 1 << 18;   // inserts + removes per thread
+    std::cout << "[" << ops << " ops per thread, hw threads=" << std::thread::hardware_concurrency() << "]\n";
+    for (std::size_t threads : {1, 2, 4, 8, 16, 32, 64}) {
+        double total = (double)(threads * ops) / 1000.0;
+        double a = run<LockedReceiptBag<int>>(threads, ops);
+        double b = run<ConcurrentReceiptBag<int, 16>>(threads, ops);
+        double c = run<ConcurrentReceiptBag<int, 64>>(threads, ops);
+        std::cout << "threads=" << threads
+                  << "  1 lock: " << total / a << " Mops/s"
+                  << "  16 shards: " << total / b << " Mops/s"
+                  << "  64 shards: " << total / c << " Mops/s\n";
+    }
+    return 0;
+}
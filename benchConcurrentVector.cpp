@@ -0,0 +1,58 @@
+// benchConcurrentVector.cpp
+// T threads each append M ints into one shared collection:
+// ConcurrentVector (lock-free) vs Vector<int> behind a std::mutex.
+// build: g++ -std=c++17 -O2 -pthread benchConcurrentVector.cpp
+#include "Vector.h"
+#include "ConcurrentVector.h"
+
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+template <class Push>
+double timeThreads(std::size_t threads, Push push) {
+    using clock = std::chrono::high_resolution_clock;
+    std::vector<std::thread> pool;
+    auto t0 = clock::now();
+    for (std::size_t t = 0; t < threads; ++t) pool.emplace_back(push, t);
+    for (auto& th : pool) th.join();
+    auto t1 = clock::now();
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+int main() {
+    const std::size_t perThread = 1000000;
+    std::size_t hw = std::thread::hardware_concurrency();
+    std::cout << "[append " << perThread << " ints per thread, hw threads=" << hw << "]\n";
+
+    for (std::size_t threads : {1, 2, 4, 8, 16}) {
+        double total = (double)(threads * perThread);
+
+        Vector<int> locked;
+        std::mutex m;
+        double msLocked = timeThreads(threads, [&](std::size_t t) {
+            for (std::size_t i = 0; i < perThread; ++i) {
+                std::lock_guard<std::mutex> g(m);
+                locked.push_back((int)(t * perThread + i));
+            }
+        });
+
+        ConcurrentVector<int> cv;
+        double msCv = timeThreads(threads, [&](std::size_t t) {
+            for (std::size_t i = 0; i < perThread; ++i) cv.push_back((int)(t * perThread + i));
+        });
+
+        long long check = 0;
+        for (std::size_t i = 0; i < cv.size(); ++i) check += cv[i];
+        long long want = 0;
+        for (std::size_t i = 0; i < locked.size(); ++i) want += locked[i];
+
+        std::cout << "threads=" << threads
+                  << " mutex+Vector ms=" << msLocked << " (" << total / msLocked / 1000 << " Mops/s)"
+                  << "  ConcurrentVector ms=" << msCv << " (" << total / msCv / 1000 << " Mops/s)"
+                  << (check == want ? "" : "  MISMATCH") << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+// benchHashBag.cpp
+// "How many of X" over a large multiset: Bag (LinkedList scan) vs HashBag
+// (one probe). Also add, remove, and merging two bags.
+#include "Bag.h"
+#include "HashBag.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+static double msSince(clock_type::time_point t0) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+}
+
+template <class B>
+void run(const char* label, const std::vector<int>& items, const std::vector<int>& queries) {
+    B bag;
+    auto t0 = clock_type::now();
+    for (int x : items) bag.add(x);
+    double addMs = msSince(t0);
+
+    t0 = clock_type::now();
+    std::size_t hits = 0;
+    for (int q : queries) hits += bag.getFrequencyOf(q) + bag.contains(q);
+    double queryMs = msSince(t0);
+
+    t0 = clock_type::now();
+    std::size_t removed = 0;
+    for (int q : queries) removed += bag.remove(q);
+    double removeMs = msSince(t0);
+
+    std::printf("  %-10s add=%8.2f ms  %zu freq+contains=%9.2f ms  %zu remove=%8.2f ms  (%zu %zu)\n", label,
+                addMs, queries.size(), queryMs, queries.size(), removeMs, hits, removed);
+}
+
+int main() {
+    std::mt19937 rng(7);
+    for (std::size_t n : {(std::size_t)100000, (std::size_t)1000000}) {
+        std::vector<int> items(n), queries(1000);
+        for (int& x : items) x = (int)(rng() % 5000);    // ~n/5000 copies of each
+        for (int& q : queries) q = (int)(rng() % 6000);  // some misses
+        std::printf("n=%zu items, 5000 distinct\n", n);
+        run<Bag<int>>("Bag", items, queries);
+        run<HashBag<int>>("HashBag", items, queries);
+    }
+
+    HashBag<int> a, b;
+    for (int i = 0; i < 1000000; ++i) { a.add(i % 100000); b.add(i % 70000 + 50000); }
+    auto t0 = clock_type::now();
+    a.merge(b);
+    std::printf("merge of two 10^6-item HashBags: %.2f ms (%zu items, %zu distinct)\n", msSince(t0),
+                a.getCurrentSize(), a.distinctCount());
+    return 0;
+}
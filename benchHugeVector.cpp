@@ -0,0 +1,58 @@
+// benchHugeVector.cpp
+// Grow a Vector<int> / Vector<POD> to a few hundred MB with push_back and
+// compare growth time and peak RSS: heap (copy on every doubling) vs
+// MremapStorage (mremap on every doubling past the threshold).
+// Each case runs in its own forked process so peak RSS isn't shared.
+#include "Vector.h"
+#include "MremapStorage.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+struct Rec { long id; double a, b, c; };   // 32-byte POD payload
+
+template <class V, class Make>
+void grow(const char* label, std::size_t n, Make make) {
+    using clock = std::chrono::high_resolution_clock;
+    std::fflush(stdout);
+    pid_t pid = fork();
+    if (pid == 0) {
+        V v;
+        auto t0 = clock::now();
+        for (std::size_t i = 0; i < n; ++i) v.push_back(make(i));
+        auto t1 = clock::now();
+        rusage ru{};
+        getrusage(RUSAGE_SELF, &ru);
+        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
+        std::cout << label << " n=" << n << " ms=" << ms
+                  << " peakRSS=" << ru.ru_maxrss / 1024 << "MB"
+                  << " dataMB=" << v.capacity() * sizeof(v[0]) / (1024 * 1024) << std::endl;
+        _exit(0);
+    }
+    int status = 0;
+    waitpid(pid, &status, 0);
+}
+
+int main() {
+    auto mkInt = [](std::size_t i) { return (int)i; };
+    auto mkRec = [](std::size_t i) { return Rec{(long)i, 1.0, 2.0, 3.0}; };
+
+    std::cout << "[Vector<int>]\n";
+    for (std::size_t n : {(std::size_t)1 << 24, (std::size_t)1 << 26}) {
+        grow<Vector<int>>("heap   ", n, mkInt);
+        grow<HugeVector<int>>("mremap ", n, mkInt);
+        grow<Vector<int, DoublingGrowth, MremapStorage<((std::size_t)1 << 21), HugePageAdvice>>>(
+            "mremap+thp", n, mkInt);
+    }
+
+    std::cout << "\n[Vector<Rec>] (32-byte POD)\n";
+    for (std::size_t n : {(std::size_t)1 << 22, (std::size_t)1 << 24}) {
+        grow<Vector<Rec>>("heap   ", n, mkRec);
+        grow<HugeVector<Rec>>("mremap ", n, mkRec);
+    }
+    return 0;
+}
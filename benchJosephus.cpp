@@ -0,0 +1,50 @@
+// benchJosephus.cpp
+// Queue simulation (LinkedList Queue and RingQueue, O(N*M)) vs the O(N)
+// recurrence, the O(k log N) recurrence and the O(N log N) Fenwick order.
+#include "Josephus.h"
+#include "RingQueue.h"
+
+#include <chrono>
+#include <cstdio>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+static double msSince(clock_type::time_point t0) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+}
+
+template <class F>
+void timeIt(const char* label, F f) {
+    auto t0 = clock_type::now();
+    long long r = f();
+    std::printf("  %-32s ms=%10.3f  (%lld)\n", label, msSince(t0), r);
+}
+
+int main() {
+    const int M = 2;
+    for (int N : {10000, 1000000}) {
+        std::printf("N=%d, M=%d\n", N, M);
+        timeIt("winner: Queue simulation", [&] { return (long long)josephusWinner(N, M); });
+        timeIt("winner: RingQueue simulation", [&] { return (long long)josephusWinner<RingQueue<int>>(N, M); });
+        timeIt("winner: O(N) recurrence", [&] { return josephusWinnerLinear(N, M); });
+        timeIt("winner: O(k log N) recurrence", [&] { return josephusWinnerFast(N, M); });
+        timeIt("order: Queue simulation", [&] { return (long long)josephusOrder(N, M).back(); });
+        timeIt("order: RingQueue simulation", [&] { return (long long)josephusOrder<RingQueue<int>>(N, M).back(); });
+        timeIt("order: Fenwick", [&] { return (long long)josephusOrderFenwick(N, M).back(); });
+    }
+
+    // large M: the simulation pays M rotations per elimination, Fenwick doesn't
+    {
+        const int N = 100000, bigM = 1000;
+        std::printf("N=%d, M=%d\n", N, bigM);
+        timeIt("order: RingQueue simulation", [&] { return (long long)josephusOrder<RingQueue<int>>(N, bigM).back(); });
+        timeIt("order: Fenwick", [&] { return (long long)josephusOrderFenwick(N, bigM).back(); });
+        timeIt("winner: O(N) recurrence", [&] { return josephusWinnerLinear(N, bigM); });
+    }
+
+    std::printf("huge N, M=%d (recurrence only)\n", M);
+    timeIt("winner: O(N) N=10^8", [&] { return josephusWinnerLinear(100000000LL, M); });
+    timeIt("winner: O(k log N) N=10^9", [&] { return josephusWinnerFast(1000000000LL, M); });
+    timeIt("winner: O(k log N) N=10^18", [&] { return josephusWinnerFast(1000000000000000000LL, M); });
+    return 0;
+}
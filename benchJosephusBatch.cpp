@@ -0,0 +1,81 @@
+// benchJosephusBatch.cpp
+// Queries per second for a parameter sweep of josephusWinner(N, M):
+// one call per query (Queue simulation, O(N) and O(k log N) recurrences)
+// vs JosephusEngine batches on 1 and several threads.
+// build: g++ -std=c++17 -O2 -pthread benchJosephusBatch.cpp  (add -march=native for wider SIMD)
+#include "JosephusBatch.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+static double secondsSince(clock_type::time_point t0) {
+    return std::chrono::duration<double>(clock_type::now() - t0).count();
+}
+
+static void report(const char* label, std::size_t queries, double s, long long check) {
+    std::printf("  %-34s %12.0f queries/s  (%zu in %.3f s, check %lld)\n", label, queries / s, queries, s, check);
+}
+
+template <class F>
+void perCall(const char* label, const std::vector<JosephusQuery>& qs, std::size_t limit, F f) {
+    std::size_t n = qs.size() < limit ? qs.size() : limit;
+    long long check = 0;
+    auto t0 = clock_type::now();
+    for (std::size_t i = 0; i < n; ++i) check += f(qs[i]);
+    report(label, n, secondsSince(t0), check);
+}
+
+void batched(const char* label, JosephusEngine& e, const std::vector<JosephusQuery>& qs) {
+    std::vector<long long> out(qs.size());
+    auto t0 = clock_type::now();
+    e.winners(qs.data(), qs.size(), out.data());
+    double s = secondsSince(t0);
+    long long check = 0;
+    for (long long w : out) check += w;
+    report(label, qs.size(), s, check);
+}
+
+void runAll(const std::vector<JosephusQuery>& qs, std::size_t simLimit, std::size_t linearLimit) {
+    perCall("per call: Queue simulation", qs, simLimit,
+            [](const JosephusQuery& q) { return (long long)josephusWinner((int)q.N, (int)q.M); });
+    perCall("per call: O(N) recurrence", qs, linearLimit,
+            [](const JosephusQuery& q) { return josephusWinnerLinear(q.N, q.M); });
+    perCall("per call: O(k log N) recurrence", qs, qs.size(),
+            [](const JosephusQuery& q) { return josephusWinnerFast(q.N, q.M); });
+    JosephusEngine one(1);
+    batched("JosephusEngine, 1 thread", one, qs);
+    JosephusEngine all;
+    char label[64];
+    std::snprintf(label, sizeof label, "JosephusEngine, hw threads (%zu)", all.threadCount());
+    batched(label, all, qs);
+}
+
+int main() {
+    std::mt19937_64 rng(11);
+    std::printf("hardware threads: %u\n", std::thread::hardware_concurrency());
+
+    // dense sweep: 10^6 queries over N <= 10^5, M in 1..64
+    {
+        std::vector<JosephusQuery> qs(1000000);
+        for (auto& q : qs) q = JosephusQuery{(long long)(rng() % 100000) + 1, (long long)(rng() % 64) + 1};
+        std::printf("dense sweep: 10^6 queries, N <= 10^5, M in 1..64\n");
+        runAll(qs, 50, 20000);
+    }
+
+    // sparse huge N: 10^5 queries, N up to 10^12, M in 1..16
+    {
+        std::vector<JosephusQuery> qs(100000);
+        for (auto& q : qs) q = JosephusQuery{(long long)(rng() % 1000000000000LL) + 1, (long long)(rng() % 16) + 1};
+        std::printf("huge N: 10^5 queries, N <= 10^12, M in 1..16\n");
+        std::printf("  (per-call simulation and O(N) recurrence skipped)\n");
+        perCall("per call: O(k log N) recurrence", qs, qs.size(),
+                [](const JosephusQuery& q) { return josephusWinnerFast(q.N, q.M); });
+        JosephusEngine all;
+        batched("JosephusEngine", all, qs);
+    }
+    return 0;
+}
@@ -0,0 +1,95 @@
+// benchLinkedList.cpp
+// Bag::getFrequencyOf / contains / remove and CircularList::traverseFrom:
+// the old getEntry(1..n) loops (O(n^2) node walks) vs the iterator
+// versions (O(n)), CircularList's copy-free viewFrom and cursor ops, plus
+// Bag::add and the Queue-based Josephus simulation now that appends go
+// through the list's tail.
+#include "LinkedList.h"
+#include "Bag.h"
+#include "CircularList.h"
+#include "Josephus.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+static double msSince(clock_type::time_point t0) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+}
+
+// the previous implementations, written against getEntry(i)
+template <class T>
+std::size_t frequencyByIndex(const ListInterface<T>& data, const T& item) {
+    std::size_t count = 0;
+    for (std::size_t i = 1; i <= data.getLength(); ++i)
+        if (data.getEntry(i) == item) ++count;
+    return count;
+}
+template <class T>
+std::vector<T> traverseByIndex(const ListInterface<T>& l, std::size_t startIndex) {
+    std::vector<T> out;
+    std::size_t n = l.getLength();
+    out.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) out.push_back(l.getEntry(((startIndex - 1 + i) % n) + 1));
+    return out;
+}
+
+
+int main() {
+    const std::size_t indexLimit = 50000;   // the index loops are quadratic
+    for (std::size_t n : {(std::size_t)10000, (std::size_t)100000, (std::size_t)1000000}) {
+        CircularList<int> list;
+        Bag<int> bag;
+        for (std::size_t i = 0; i < n; ++i) list.push_front((int)(i % 100));
+        auto t0 = clock_type::now();
+        for (std::size_t i = 0; i < n; ++i) bag.add((int)(i % 100));   // O(1) each via the tail
+        std::cout << "n=" << n << "\n";
+        std::cout << "  Bag add x n              ms=" << msSince(t0) << "\n";
+
+        t0 = clock_type::now();
+        std::size_t f = bag.getFrequencyOf(7);
+        bool has = bag.contains(-1);
+        std::cout << "  Bag frequency+contains   iter ms=" << msSince(t0) << " (" << f << ", " << has << ")\n";
+
+        t0 = clock_type::now();
+        std::vector<int> v = list.traverseFrom(n / 2);
+        std::cout << "  traverseFrom(n/2)        iter ms=" << msSince(t0) << " (" << v.size() << ")\n";
+
+        t0 = clock_type::now();
+        long long sum = 0;
+        for (int x : list.viewFrom(n / 2)) sum += x;   // same loop, no copy
+        std::cout << "  viewFrom(n/2) sum        view ms=" << msSince(t0) << " (" << sum << ")\n";
+
+        t0 = clock_type::now();
+        std::size_t removed = 0;
+        for (int k = 0; k < 10; ++k) removed += bag.remove(99);   // matches sit near the back
+        std::cout << "  Bag remove x10           iter ms=" << msSince(t0) << " (" << removed << ")\n";
+
+        if (n <= indexLimit) {
+            t0 = clock_type::now();
+            std::size_t g = frequencyByIndex(list, 7);
+            std::cout << "  getEntry frequency      index ms=" << msSince(t0) << " (" << g << ")\n";
+            t0 = clock_type::now();
+            std::vector<int> w = traverseByIndex(list, n / 2);
+            std::cout << "  getEntry traverseFrom   index ms=" << msSince(t0)
+                      << (w == v ? "" : "  MISMATCH") << "\n";
+        } else {
+            std::cout << "  getEntry loops          (skipped, ~n^2/2 = " << (double)n * n / 2 << " node walks)\n";
+        }
+
+        t0 = clock_type::now();
+        for (int k = 0; k < 1000; ++k) list.rotate(3);
+        for (int k = 0; k < 1000; ++k) { list.advance(2); list.removeAtCursor(); list.insertAfterCursor(k); }
+        std::cout << "  rotate/advance/remove x1000 ring ms=" << msSince(t0) << " (" << list.getLength() << ")\n";
+    }
+
+    // every enqueue used to walk the whole queue; now the simulation is O(N*M)
+    for (int N : {10000, 100000, 1000000}) {
+        auto t0 = clock_type::now();
+        int w = josephusWinner(N, 3);
+        std::cout << "josephusWinner(" << N << ", 3) ms=" << msSince(t0) << " (winner " << w << ")\n";
+    }
+    return 0;
+}
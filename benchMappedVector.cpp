@@ -0,0 +1,69 @@
+// benchMappedVector.cpp
+// Startup cost of a big Vector<int> table: rebuild from scratch vs
+// loadVector (read + copy) vs MappedVector (mmap, pages fault in lazily),
+// plus the first full scan over each, and writable append throughput.
+#include "Vector.h"
+#include "MappedVector.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+static double msSince(clock_type::time_point t0) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+}
+
+template <class V>
+long long scan(const V& v) {
+    long long sum = 0;
+    for (std::size_t i = 0; i < v.size(); ++i) sum += v[i];
+    return sum;
+}
+
+int main() {
+    const std::size_t n = (std::size_t)1 << 25;   // 128 MB of ints
+    const char* path = "bench_vector.bin";
+
+    auto t0 = clock_type::now();
+    Vector<int> built;
+    built.reserve(n);
+    for (std::size_t i = 0; i < n; ++i) built.push_back((int)(i * 7 % 1000));
+    std::cout << "rebuild        ms=" << msSince(t0) << "\n";
+
+    t0 = clock_type::now();
+    saveVector(built, path);
+    std::cout << "saveVector     ms=" << msSince(t0) << "\n";
+
+    t0 = clock_type::now();
+    Vector<int> loaded;
+    loadVector(path, loaded);
+    std::cout << "loadVector     ms=" << msSince(t0) << "\n";
+    t0 = clock_type::now();
+    long long a = scan(loaded);
+    std::cout << "  first scan   ms=" << msSince(t0) << "\n";
+
+    t0 = clock_type::now();
+    MappedVector<int> mapped(path);
+    std::cout << "MappedVector   ms=" << msSince(t0) << " size=" << mapped.size() << "\n";
+    t0 = clock_type::now();
+    long long b = scan(mapped);
+    std::cout << "  first scan   ms=" << msSince(t0) << (a == b ? "" : "  MISMATCH") << "\n";
+
+    const char* logPath = "bench_append.bin";
+    std::remove(logPath);
+    t0 = clock_type::now();
+    {
+        auto log = MappedVector<int>::appendTo(logPath, 1 << 16);
+        for (std::size_t i = 0; i < n / 8; ++i) log.push_back((int)i);
+        log.sync();
+    }
+    std::cout << "append " << n / 8 << " ms=" << msSince(t0) << "\n";
+    MappedVector<int> reread(logPath);
+    std::cout << "  reopened size=" << reread.size() << " last=" << reread[reread.size() - 1] << "\n";
+
+    std::remove(path);
+    std::remove(logPath);
+    return 0;
+}
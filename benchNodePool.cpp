@@ -0,0 +1,85 @@
+// benchNodePool.cpp
+// Allocator calls per op and time for Stack push/pop and Queue
+// enqueue/dequeue with each LinkedList node policy (NodePool.h).
+// Global operator new/delete are overridden to count calls.
+#include "Stack.h"
+#include "Queue.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+static std::size_t g_news = 0;
+static std::size_t g_deletes = 0;
+
+void* operator new(std::size_t n) {
+    ++g_news;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { if (p) ++g_deletes; std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { if (p) ++g_deletes; std::free(p); }
+
+using clock_type = std::chrono::high_resolution_clock;
+
+// message-passing shaped loop: the container breathes between 0 and depth
+template <class Q, class Push, class Pop>
+void run(const char* label, std::size_t rounds, std::size_t depth, Push push, Pop pop) {
+    Q q;
+    g_news = g_deletes = 0;
+    auto t0 = clock_type::now();
+    for (std::size_t r = 0; r < rounds; ++r) {
+        for (std::size_t i = 0; i < depth; ++i) push(q, (int)i);
+        for (std::size_t i = 0; i < depth; ++i) pop(q);
+    }
+    double ms = std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+    double ops = 2.0 * rounds * depth;
+    std::printf("  %-28s new/op=%.6f delete/op=%.6f (%zu/%zu)  ns/op=%.1f\n", label,
+                g_news / ops, g_deletes / ops, g_news, g_deletes, ms * 1e6 / ops);
+}
+
+template <class A>
+void stackCase(const char* label, std::size_t rounds, std::size_t depth) {
+    run<Stack<int, A>>(label, rounds, depth,
+                       [](Stack<int, A>& s, int x) { s.push(x); },
+                       [](Stack<int, A>& s) { s.pop(); });
+}
+template <class A>
+void queueCase(const char* label, std::size_t rounds, std::size_t depth) {
+    run<Queue<int, A>>(label, rounds, depth,
+                       [](Queue<int, A>& q, int x) { q.enqueue(x); },
+                       [](Queue<int, A>& q) { q.dequeue(); });
+}
+
+// clear() of a full list: node-by-node vs whole slabs
+template <class A>
+void clearCase(const char* label, std::size_t n) {
+    Queue<int, A> q;
+    for (std::size_t i = 0; i < n; ++i) q.enqueue((int)i);
+    g_deletes = 0;
+    auto t0 = clock_type::now();
+    q.clear();
+    double ms = std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+    std::printf("  %-28s deletes=%zu  ms=%.3f\n", label, g_deletes, ms);
+}
+
+int main() {
+    const std::size_t rounds = 2000, depth = 1000;
+    std::printf("Stack push/pop, %zu rounds of depth %zu\n", rounds, depth);
+    stackCase<NewNodeAlloc>("NewNodeAlloc", rounds, depth);
+    stackCase<PooledNodeAlloc<>>("PooledNodeAlloc<64>", rounds, depth);
+    stackCase<SharedNodeAlloc<>>("SharedNodeAlloc<64>", rounds, depth);
+
+    std::printf("Queue enqueue/dequeue, %zu rounds of depth %zu\n", rounds, depth);
+    queueCase<NewNodeAlloc>("NewNodeAlloc", rounds, depth);
+    queueCase<PooledNodeAlloc<>>("PooledNodeAlloc<64>", rounds, depth);
+    queueCase<SharedNodeAlloc<>>("SharedNodeAlloc<64>", rounds, depth);
+
+    std::printf("clear() of 10^6 queued ints\n");
+    clearCase<NewNodeAlloc>("NewNodeAlloc", 1000000);
+    clearCase<PooledNodeAlloc<>>("PooledNodeAlloc<64>", 1000000);
+    clearCase<PooledNodeAlloc<1024>>("PooledNodeAlloc<1024>", 1000000);
+    return 0;
+}
@@ -0,0 +1,71 @@
+// benchReceiptBag.cpp
+// Insert n items, then redeem every receipt in random order:
+// slot-map ReceiptBag vs the old receipt scan + swap-remove.
+#include "Vector.h"
+#include "ReceiptBag.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+// the previous ReceiptBag: linear scan of recs to find the receipt
+template <class T>
+class ScanReceiptBag {
+private:
+    Vector<int> recs;
+    Vector<T>   items;
+    int nextRec = 1;
+
+public:
+    std::size_t size() const { return items.size(); }
+
+    int insert(const T& x) {
+        recs.push_back(nextRec);
+        items.push_back(x);
+        return nextRec++;
+    }
+
+    T remove(int receipt) {
+        for (std::size_t i = 0; i < recs.size(); ++i) {
+            if (recs[i] == receipt) {
+                T out = items[i];
+                recs[i] = recs[recs.size() - 1];
+                items[i] = items[items.size() - 1];
+                recs.pop_back();
+                items.pop_back();
+                return out;
+            }
+        }
+        throw std::invalid_argument("invalid receipt");
+    }
+};
+
+template <class Bag>
+double run(std::size_t n, unsigned seed) {
+    using clock = std::chrono::high_resolution_clock;
+    Bag bag;
+    std::vector<decltype(bag.insert(0))> receipts;
+    receipts.reserve(n);
+    auto t0 = clock::now();
+    for (std::size_t i = 0; i < n; ++i) receipts.push_back(bag.insert((int)i));
+    std::shuffle(receipts.begin(), receipts.end(), std::mt19937(seed));
+    long long sum = 0;
+    for (auto r : receipts) sum += bag.remove(r);
+    auto t1 = clock::now();
+    if (sum != (long long)n * (long long)(n - 1) / 2 || bag.size() != 0) std::cout << "  MISMATCH\n";
+    return std::chrono::duration<double, std::milli>(t1 - t0).count();
+}
+
+int main() {
+    const std::size_t scanLimit = 100000;   // the scan is O(n^2); 10^6 would take hours
+    for (std::size_t n : {(std::size_t)1000, (std::size_t)10000, (std::size_t)100000, (std::size_t)1000000}) {
+        std::cout << "n=" << n << "  slot map ms=" << run<ReceiptBag<int>>(n, 42);
+        if (n <= scanLimit) std::cout << "  scan ms=" << run<ScanReceiptBag<int>>(n, 42);
+        else std::cout << "  scan (skipped)";
+        std::cout << "\n";
+    }
+    return 0;
+}
@@ -0,0 +1,70 @@
+// benchRingQueue.cpp
+// RingQueue vs the LinkedList-backed Queue (plain and slab-pooled) on a
+// producer/consumer shaped loop, bulk span transfer, and the Josephus
+// simulation.
+#include "Queue.h"
+#include "RingQueue.h"
+#include "Josephus.h"
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+static double msSince(clock_type::time_point t0) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+}
+
+// fill to depth, drain, repeat
+template <class Q>
+void breathe(const char* label, std::size_t rounds, std::size_t depth) {
+    Q q;
+    long long sum = 0;
+    auto t0 = clock_type::now();
+    for (std::size_t r = 0; r < rounds; ++r) {
+        for (std::size_t i = 0; i < depth; ++i) q.enqueue((int)i);
+        for (std::size_t i = 0; i < depth; ++i) { sum += q.front(); q.dequeue(); }
+    }
+    double ms = msSince(t0);
+    std::printf("  %-28s ns/op=%6.2f  (%lld)\n", label, ms * 1e6 / (2.0 * rounds * depth), sum % 1000);
+}
+
+template <class Q>
+void josephus(const char* label, int N, int M) {
+    auto t0 = clock_type::now();
+    int w = josephusWinner<Q>(N, M);
+    std::printf("  %-28s ms=%8.2f  (winner %d)\n", label, msSince(t0), w);
+}
+
+int main() {
+    const std::size_t rounds = 2000, depth = 1000;
+    std::printf("enqueue/dequeue, %zu rounds of depth %zu\n", rounds, depth);
+    breathe<Queue<int>>("Queue<int>", rounds, depth);
+    breathe<Queue<int, PooledNodeAlloc<>>>("Queue<int, PooledNodeAlloc>", rounds, depth);
+    breathe<RingQueue<int>>("RingQueue<int>", rounds, depth);
+
+    // one element at a time vs spans of 256
+    {
+        std::vector<int> in(256), out(256);
+        for (int i = 0; i < 256; ++i) in[i] = i;
+        RingQueue<int> q;
+        long long sum = 0;
+        auto t0 = clock_type::now();
+        for (std::size_t r = 0; r < rounds * 4; ++r) {
+            q.enqueue(in.data(), in.size());
+            std::size_t n = q.dequeue(out.data(), out.size());
+            sum += out[n - 1];
+        }
+        std::printf("  %-28s ns/elem=%6.2f  (%lld)\n", "RingQueue<int> spans of 256",
+                    msSince(t0) * 1e6 / (2.0 * rounds * 4 * 256), sum % 1000);
+    }
+
+    for (int N : {100000, 1000000}) {
+        std::printf("josephusWinner(%d, 3)\n", N);
+        josephus<Queue<int>>("Queue<int>", N, 3);
+        josephus<Queue<int, PooledNodeAlloc<>>>("Queue<int, PooledNodeAlloc>", N, 3);
+        josephus<RingQueue<int>>("RingQueue<int>", N, 3);
+    }
+    return 0;
+}
@@ -0,0 +1,48 @@
+// benchSmallVector.cpp
+// Short-list workload: build lots of lists of 1..8 ints (plus a few longer
+// ones) and count heap allocations and time for Vector vs SmallVector.
+#include "Vector.h"
+#include "SmallVector.h"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+static std::size_t g_allocs = 0;
+
+void* operator new(std::size_t n) {
+    ++g_allocs;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+template <class V>
+void run(const char* label, std::size_t lists) {
+    using clock = std::chrono::high_resolution_clock;
+    std::size_t before = g_allocs;
+    long long sum = 0;
+    auto t0 = clock::now();
+    for (std::size_t l = 0; l < lists; ++l) {
+        std::size_t len = (l % 64 == 0) ? 40 : 1 + l % 8;   // mostly <= 8
+        V v;
+        for (std::size_t i = 0; i < len; ++i) v.push_back((int)(l + i));
+        V moved = std::move(v);                           // hand it off, like a return
+        for (std::size_t i = 0; i < moved.size(); ++i) sum += moved[i];
+    }
+    auto t1 = clock::now();
+    auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
+    std::cout << label << " lists=" << lists << " allocs=" << (g_allocs - before)
+              << " allocs/list=" << (double)(g_allocs - before) / lists
+              << " ms=" << ms << " (sum " << sum << ")\n";
+}
+
+int main() {
+    for (std::size_t lists : {(std::size_t)100000, (std::size_t)1000000}) {
+        run<Vector<int>>("Vector<int>        ", lists);
+        run<SmallVector<int, 8>>("SmallVector<int,8> ", lists);
+    }
+    return 0;
+}
@@ -0,0 +1,99 @@
+// benchStack.cpp
+// Stack (LinkedList nodes, plain and pooled) vs ArrayStack on an
+// expression-evaluator shaped loop, and ConcurrentStack vs a Stack behind
+// one mutex as a shared free list.
+// build: g++ -std=c++17 -O2 -pthread benchStack.cpp
+#include "Stack.h"
+#include "ArrayStack.h"
+#include "ConcurrentStack.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+static double msSince(clock_type::time_point t0) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+}
+
+// evaluate a long RPN-like stream: 8 operands, then 8 operators that each
+// pop two and push the sum, so the stack stays shallow like a real
+// evaluator's
+template <class S>
+void evaluator(const char* label, std::size_t tokens) {
+    S s;
+    auto t0 = clock_type::now();
+    for (std::size_t i = 0; i < tokens; ++i) {
+        if (i % 16 >= 8 && s.getSize() >= 2) {
+            long long b = s.top(); s.pop();
+            long long a = s.top(); s.pop();
+            s.push((a + b) & 0xffff);
+        } else {
+            s.push((long long)i);
+        }
+    }
+    long long r = 0;
+    while (!s.isEmpty()) { r += s.top(); s.pop(); }
+    std::printf("  %-30s ns/token=%6.2f  (%lld)\n", label, msSince(t0) * 1e6 / tokens, r % 1000);
+}
+
+template <class T>
+class LockedStack {
+private:
+    std::mutex lock;
+    Stack<T> s;
+
+public:
+    void push(const T& x) { std::lock_guard<std::mutex> g(lock); s.push(x); }
+    bool try_pop(T& out) {
+        std::lock_guard<std::mutex> g(lock);
+        if (s.isEmpty()) return false;
+        out = s.top();
+        s.pop();
+        return true;
+    }
+};
+
+// each thread takes a block from the shared free list (or makes one) and
+// hands it back, like workers recycling buffers
+template <class S>
+void freeList(const char* label, std::size_t threads, std::size_t opsPerThread) {
+    S s;
+    for (long long i = 0; i < 256; ++i) s.push(i);
+    std::vector<std::thread> ts;
+    std::atomic<long long> misses{0};
+    auto t0 = clock_type::now();
+    for (std::size_t t = 0; t < threads; ++t)
+        ts.emplace_back([&s, &misses, opsPerThread] {
+            long long x;
+            long long miss = 0;
+            for (std::size_t i = 0; i < opsPerThread; ++i) {
+                if (!s.try_pop(x)) { x = 0; ++miss; }
+                s.push(x + 1);
+            }
+            misses += miss;
+        });
+    for (auto& t : ts) t.join();
+    double ms = msSince(t0);
+    std::printf("  %-30s %zu threads  M ops/s=%7.2f  (misses %lld)\n", label, threads,
+                2.0 * threads * opsPerThread / ms / 1e3, misses.load());
+}
+
+int main() {
+    const std::size_t tokens = 30000000;
+    std::printf("evaluator, %zu tokens\n", tokens);
+    evaluator<Stack<long long>>("Stack<ll>", tokens);
+    evaluator<Stack<long long, PooledNodeAlloc<>>>("Stack<ll, PooledNodeAlloc>", tokens);
+    evaluator<ArrayStack<long long>>("ArrayStack<ll, 16>", tokens);
+
+    std::printf("shared free list (hardware threads: %u)\n", std::thread::hardware_concurrency());
+    for (std::size_t t : {(std::size_t)1, (std::size_t)4}) {
+        freeList<LockedStack<long long>>("mutex + Stack", t, 2000000 / t);
+        freeList<ConcurrentStack<long long>>("ConcurrentStack", t, 2000000 / t);
+    }
+    return 0;
+}
@@ -0,0 +1,57 @@
+// benchUnrolledList.cpp
+// UnrolledList vs LinkedList through ListInterface: random positional
+// inserts, a getEntry(i) scan over a window, a full iterator scan, and
+// random positional removes.
+#include "LinkedList.h"
+#include "UnrolledList.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using clock_type = std::chrono::high_resolution_clock;
+
+static double msSince(clock_type::time_point t0) {
+    return std::chrono::duration<double, std::milli>(clock_type::now() - t0).count();
+}
+
+template <class L>
+void run(const char* label, std::size_t n) {
+    std::mt19937 rng(42);
+    L list;
+
+    auto t0 = clock_type::now();
+    for (std::size_t i = 0; i < n; ++i)
+        list.insert(rng() % (list.getLength() + 1) + 1, (int)i);
+    double insertMs = msSince(t0);
+
+    // positional reads over 1000 spread-out positions
+    t0 = clock_type::now();
+    long long sum = 0;
+    for (std::size_t k = 1; k <= 1000; ++k) sum += list.getEntry(k * n / 1000);
+    double getMs = msSince(t0);
+
+    t0 = clock_type::now();
+    long long scan = 0;
+    for (int x : list) scan += x;
+    double scanMs = msSince(t0);
+
+    t0 = clock_type::now();
+    for (std::size_t i = 0; i < n / 2; ++i) list.remove(rng() % list.getLength() + 1);
+    double removeMs = msSince(t0);
+
+    std::printf("  %-20s insert=%9.2f ms  getEntry x1000=%8.3f ms  scan=%7.3f ms  remove n/2=%9.2f ms  (%lld %lld)\n",
+                label, insertMs, getMs, scanMs, removeMs, sum % 1000, scan % 1000);
+}
+
+int main() {
+    for (std::size_t n : {(std::size_t)10000, (std::size_t)20000, (std::size_t)200000}) {
+        std::printf("n=%zu\n", n);
+        if (n <= 20000) run<LinkedList<int>>("LinkedList", n);
+        else std::printf("  %-20s (skipped: quadratic)\n", "LinkedList");
+        run<UnrolledList<int, 16>>("UnrolledList<16>", n);
+        run<UnrolledList<int, 64>>("UnrolledList<64>", n);
+        run<UnrolledList<int, 256>>("UnrolledList<256>", n);
+    }
+    return 0;
+}
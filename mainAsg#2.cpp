@@ -3,21 +3,37 @@
 #include "VectorAggressive.h"
 #include "Array.h"
 #include "ReceiptBag.h"
+#include "SmallVector.h"
 
 #include <iostream>
 #include <chrono>
+#include <string>
 
-template <class V>
-void time_pushes(const char* label, std::size_t maxPow) {
+// element factories for the timing runs
+struct MakeInt    { int operator()(std::size_t i) const { return (int)i; } };
+struct MakeString { std::string operator()(std::size_t i) const { return std::string(24, (char)('a' + i % 26)); } };
+
+// caller-supplied growth policy: fixed 4096-element chunks
+struct ChunkGrowth {
+    static std::size_t nextCapacity(std::size_t cap, std::size_t want) {
+        std::size_t c = cap;
+        while (c < want) c += 4096;
+        return c;
+    }
+};
+
+template <class V, class Make = MakeInt>
+void time_pushes(const char* label, std::size_t maxPow, std::size_t minPow = 1) {
     using clock = std::chrono::high_resolution_clock;
-    for (std::size_t p = 1; p <= maxPow; ++p) {
+    Make make;
+    for (std::size_t p = minPow; p <= maxPow; ++p) {
         std::size_t n = (std::size_t)1 << p; // 2^p
         V v;
         auto t0 = clock::now();
-        for (std::size_t i = 0; i < n; ++i) v.push_back((int)i);
+        for (std::size_t i = 0; i < n; ++i) v.push_back(make(i));
         auto t1 = clock::now();
-        auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count();
-        std::cout << label << " n=" << n << " ms=" << ms << "\n";
+        auto us = std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count();
+        std::cout << label << " n=" << n << " us=" << us << "\n";
     }
 }
 
@@ -27,6 +43,29 @@ int main() {
     time_pushes<Vector<int>>("base", 12);                 // up to 4096
     time_pushes<VectorCopyAlgo<int>>("copyAlgo", 12);
     time_pushes<VectorAggressive<int>>("aggressive", 12);
+    time_pushes<Vector<int, HalfAgainGrowth>>("halfAgain", 12);
+    time_pushes<Vector<int, ChunkGrowth>>("chunk", 12);
+
+    // ---- timing: non-trivial payload, where growth used to default-construct
+    // and copy-assign every slot (now relocated into raw storage)
+    std::cout << "\n[timing std::string]\n";
+    time_pushes<Vector<std::string>, MakeString>("base", 20, 14);
+    time_pushes<VectorCopyAlgo<std::string>, MakeString>("copyAlgo", 20, 14);
+    time_pushes<VectorAggressive<std::string>, MakeString>("aggressive", 20, 14);
+    time_pushes<Vector<std::string, HalfAgainGrowth>, MakeString>("halfAgain", 20, 14);
+
+    // ---- shrink policy quick check
+    std::cout << "\n[shrink test]\n";
+    using Tracked = CountingStorage<>;
+    Vector<int, DoublingGrowth, Tracked, HysteresisShrink<>> sv;
+    for (int i = 0; i < 100000; ++i) sv.push_back(i);
+    std::cout << "after spike: used=" << sv.bytesUsed() << " retained=" << sv.bytesRetained()
+              << " live=" << Tracked::liveBytes() << "\n";
+    while (sv.size() > 1000) sv.pop_back();
+    std::cout << "after drain: used=" << sv.bytesUsed() << " retained=" << sv.bytesRetained()
+              << " live=" << Tracked::liveBytes() << " released=" << Tracked::releasedBytes() << "\n";
+    sv.clear();
+    std::cout << "after clear: retained=" << sv.bytesRetained() << " live=" << Tracked::liveBytes() << "\n";
 
     // ---- Array quick check
     std::cout << "\n[array test]\n";
@@ -35,15 +74,34 @@ int main() {
     for (auto x : A) std::cout << x << " ";
     std::cout << "\n";
 
+    // ---- SmallVector quick check: appending/inserting its own elements
+    // past the inline buffer must copy them before they are moved out
+    std::cout << "\n[small vector test]\n";
+    SmallVector<std::string, 2> sm{"alpha-long-enough-to-allocate", "beta"};
+    sm.append(sm.begin(), sm.end());
+    sm.insert(1, sm.begin() + 2, sm.end());
+    for (const auto& x : sm) std::cout << "[" << x << "]";
+    std::cout << "\n";
+    sm.assign(sm.begin() + 1, sm.begin() + 3);
+    sm.assign(3, sm[0]);
+    for (const auto& x : sm) std::cout << "[" << x << "]";
+    std::cout << "\n";
+
     // ---- ReceiptBag quick check
     std::cout << "\n[receipt bag test]\n";
     ReceiptBag<std::string> rb;
-    int r1 = rb.insert("alpha");
-    int r2 = rb.insert("beta");
-    int r3 = rb.insert("gamma");
+    auto r1 = rb.insert("alpha");
+    auto r2 = rb.insert("beta");
+    auto r3 = rb.insert("gamma");
     std::cout << "size=" << rb.size() << " r1=" << r1 << " r2=" << r2 << " r3=" << r3 << "\n";
     std::cout << "removed by r2: " << rb.remove(r2) << "\n";
     std::cout << "size after: " << rb.size() << "\n";
+    std::cout << "r2 still valid? " << rb.contains(r2) << "  r3 -> " << rb.get(r3) << "\n";
+    auto r4 = rb.insert("delta");                   // reuses r2's slot, new generation
+    std::cout << "r4=" << r4 << " r2 valid after reuse? " << rb.contains(r2) << "\n";
+    rb.remove(r1);                                  // r1's slot is free with its next generation
+    auto unissued = r1 + (1ull << 32);
+    std::cout << "unissued receipt valid? " << rb.contains(unissued) << "\n";
 
     return 0;
 }
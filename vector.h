@@ -4,53 +4,278 @@
 #define VECTOR_H
 
 #include <cstddef>
+#include <algorithm> // std::copy, std::rotate
+#include <atomic>
+#include <cstring>   // std::memcpy
+#include <initializer_list>
+#include <iterator>  // std::distance, std::iterator_traits
+#include <memory>    // std::allocator, std::uninitialized_copy
+#include <new>       // placement new
 #include <stdexcept>
-#include <utility>   // std::move
+#include <type_traits>
+#include <utility>   // std::move, std::move_if_noexcept
 
-template <class T>
+// Growth policies. A policy is any type with
+//     static std::size_t nextCapacity(std::size_t cap, std::size_t want);
+// returning a capacity >= want, given the current capacity (0 if empty).
+// Pass your own as the second template argument of Vector.
+
+// start at Start, multiply by Num/Den until we have enough room
+template <std::size_t Start, std::size_t Num, std::size_t Den = 1>
+struct GeometricGrowth {
+    static_assert(Start > 0 && Num > Den, "growth must make progress");
+    static std::size_t nextCapacity(std::size_t cap, std::size_t want) {
+        std::size_t c = (cap == 0) ? Start : cap;
+        while (c < want) {
+            std::size_t n = c / Den * Num + c % Den * Num / Den;
+            c = (n > c) ? n : c + 1;
+        }
+        return c;
+    }
+};
+
+using DoublingGrowth  = GeometricGrowth<1, 2>;     // 1, 2, 4, 8, ...
+using HalfAgainGrowth = GeometricGrowth<1, 3, 2>;  // 1, 2, 3, 4, 6, 9, ...
+
+// Shrink policies. A policy provides
+//     static std::size_t shrinkCapacity(std::size_t size, std::size_t cap);
+// returning the capacity to drop to after an element removal (>= size;
+// returning cap means keep it). Checked after pop_back, clear and a
+// shrinking resize; shrink_to_fit always trims to size().
+
+// keep the peak allocation (the old behaviour)
+struct NeverShrink {
+    static std::size_t shrinkCapacity(std::size_t, std::size_t cap) { return cap; }
+};
+
+// once size drops below cap/Divisor, trim to size*Factor (Factor < Divisor
+// leaves headroom both ways, so push/pop at the boundary can't thrash).
+// clear() on a vector holding at least MinCap slots frees the buffer.
+template <std::size_t Divisor = 4, std::size_t Factor = 2, std::size_t MinCap = 16>
+struct HysteresisShrink {
+    static_assert(Factor >= 1 && Factor < Divisor, "need Factor in [1, Divisor)");
+    static std::size_t shrinkCapacity(std::size_t size, std::size_t cap) {
+        if (cap < MinCap || size >= cap / Divisor) return cap;
+        return size * Factor;
+    }
+};
+
+// Storage policies. A policy provides
+//     static void* allocate(std::size_t bytes, std::size_t align);
+//     static void  deallocate(void* p, std::size_t bytes, std::size_t align);
+//     static void* remap(void* p, std::size_t oldBytes, std::size_t newBytes);
+// remap resizes a block without copying through us (e.g. mremap) and
+// returns nullptr when it can't, in which case Vector allocates and copies.
+// Vector only calls remap for trivially copyable T. See MremapStorage.h.
+
+// plain operator new / delete
+struct HeapStorage {
+    static void* allocate(std::size_t bytes, std::size_t align) {
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) return ::operator new(bytes, std::align_val_t(align));
+        return ::operator new(bytes);
+    }
+    static void deallocate(void* p, std::size_t bytes, std::size_t align) {
+        (void)bytes;
+        if (align > __STDCPP_DEFAULT_NEW_ALIGNMENT__) ::operator delete(p, std::align_val_t(align));
+        else ::operator delete(p);
+    }
+    static void* remap(void*, std::size_t, std::size_t) { return nullptr; }
+};
+
+// wraps another storage policy and keeps process-wide counters, e.g. to
+// compare retained bytes against Vector::bytesUsed() across a worker pool
+template <class Inner = HeapStorage>
+struct CountingStorage {
+    static std::atomic<std::size_t>& liveBytes()     { static std::atomic<std::size_t> n{0}; return n; }
+    static std::atomic<std::size_t>& releasedBytes() { static std::atomic<std::size_t> n{0}; return n; }
+
+    static void* allocate(std::size_t bytes, std::size_t align) {
+        void* p = Inner::allocate(bytes, align);
+        liveBytes() += bytes;
+        return p;
+    }
+    static void deallocate(void* p, std::size_t bytes, std::size_t align) {
+        Inner::deallocate(p, bytes, align);
+        liveBytes() -= bytes;
+        releasedBytes() += bytes;
+    }
+    static void* remap(void* p, std::size_t oldBytes, std::size_t newBytes) {
+        void* q = Inner::remap(p, oldBytes, newBytes);
+        if (q) {
+            liveBytes() += newBytes;
+            liveBytes() -= oldBytes;
+            if (newBytes < oldBytes) releasedBytes() += oldBytes - newBytes;
+        }
+        return q;
+    }
+};
+
+template <class T, class Growth = DoublingGrowth, class Storage = HeapStorage, class Shrink = NeverShrink>
 class Vector {
 protected:
     T* data_ = nullptr;
     std::size_t size_ = 0;
     std::size_t cap_ = 0;
 
-    // growth policy: start at 1, double until we have enough room
-    virtual std::size_t nextCapacity(std::size_t want) const {
-        std::size_t c = (cap_ == 0) ? 1 : cap_;
-        while (c < want) c *= 2;
-        return c;
+    // raw storage: capacity slots are NOT constructed, only [0, size_) is live
+    static T* allocate(std::size_t n) {
+        return n ? static_cast<T*>(Storage::allocate(n * sizeof(T), alignof(T))) : nullptr;
+    }
+    static void deallocate(T* p, std::size_t n) {
+        if (p) Storage::deallocate(p, n * sizeof(T), alignof(T));
+    }
+    static void destroyRange(T* first, T* last) {
+        if constexpr (!std::is_trivially_destructible<T>::value)
+            for (; first != last; ++first) first->~T();
     }
 
-    // reallocate if needed; base class uses a simple for-loop copy
-    virtual void growIfNeeded(std::size_t minCap) {
-        if (cap_ >= minCap) return;
-        std::size_t newCap = nextCapacity(minCap);
-        T* nd = new T[newCap];
-        for (std::size_t i = 0; i < size_; ++i) nd[i] = data_[i];
-        delete[] data_;
+    // construct n elements at uninitialized dst from the live ones at src,
+    // leaving src alone. memcpy for trivially copyable T; otherwise move if
+    // that can't throw, else copy (so a throwing copy leaves src intact).
+    static void transfer(T* src, std::size_t n, T* dst) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (n) std::memcpy(static_cast<void*>(dst), static_cast<const void*>(src), n * sizeof(T));
+        } else {
+            std::size_t i = 0;
+            try {
+                for (; i < n; ++i) ::new (static_cast<void*>(dst + i)) T(std::move_if_noexcept(src[i]));
+            } catch (...) {
+                destroyRange(dst, dst + i);
+                throw;
+            }
+        }
+    }
+
+    // Swap in a fresh buffer of newCap slots. build(p) first constructs
+    // count new elements at p = nd + at; then the live elements are moved
+    // around that gap ([0,at) before it, [at,size_) after it). Building
+    // first means the source of the new elements may live in our old
+    // buffer. Either everything lands or the vector is left untouched.
+    template <class Build>
+    void reallocateWith(std::size_t newCap, std::size_t at, std::size_t count, Build build) {
+        T* nd = allocate(newCap);
+        std::size_t done = 0;   // 0: nothing, 1: gap built, 2: head moved
+        try {
+            build(nd + at);
+            done = 1;
+            transfer(data_, at, nd);
+            done = 2;
+            transfer(data_ + at, size_ - at, nd + at + count);
+        } catch (...) {
+            if (done == 2) destroyRange(nd, nd + at);
+            if (done >= 1) destroyRange(nd + at, nd + at + count);
+            deallocate(nd, newCap);
+            throw;
+        }
+        destroyRange(data_, data_ + size_);
+        deallocate(data_, cap_);
         data_ = nd;
+        size_ += count;
         cap_ = newCap;
     }
 
+    // Move to newCap slots. Trivially copyable T first asks the storage to
+    // remap the block in place (no element copies); anything that might
+    // point into the old buffer is invalid afterwards, so callers with such
+    // sources use reallocateWith instead.
+    void reallocate(std::size_t newCap) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            if (data_) {
+                void* q = Storage::remap(data_, cap_ * sizeof(T), newCap * sizeof(T));
+                if (q) { data_ = static_cast<T*>(q); cap_ = newCap; return; }
+            }
+        }
+        reallocateWith(newCap, size_, 0, [](T*) {});
+    }
+
+    std::size_t nextCapacity(std::size_t want) const {
+        return Growth::nextCapacity(cap_, want);
+    }
+
+    // reallocate if needed (resolved at compile time, so the check inlines)
+    void growIfNeeded(std::size_t minCap) {
+        if (cap_ >= minCap) return;
+        reallocate(nextCapacity(minCap));
+    }
+
+    // emplace_back slow path: kept out of the hot path so push_back itself
+    // is just a capacity check and a construct. The new element is built in
+    // the new buffer before the old one is released, so args may refer to
+    // our own elements.
+    template <class... Args>
+    [[gnu::noinline]] void growAndEmplace(Args&&... args) {
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            T tmp(std::forward<Args>(args)...);     // cheap; lets reallocate remap
+            reallocate(nextCapacity(size_ + 1));
+            ::new (static_cast<void*>(data_ + size_)) T(tmp);
+            ++size_;
+        } else {
+            reallocateWith(nextCapacity(size_ + 1), size_, 1, [&](T* p) {
+                ::new (static_cast<void*>(p)) T(std::forward<Args>(args)...);
+            });
+        }
+    }
+
+    template <class It>
+    static constexpr bool isForward() {
+        return std::is_base_of<std::forward_iterator_tag,
+                               typename std::iterator_traits<It>::iterator_category>::value;
+    }
+
+    // copy rhs into a buffer of cap slots (cap >= rhs.size_)
+    static T* cloneBuffer(const Vector& rhs, std::size_t cap) {
+        T* nd = allocate(cap);
+        try {
+            std::uninitialized_copy(rhs.data_, rhs.data_ + rhs.size_, nd);
+        } catch (...) {
+            deallocate(nd, cap);
+            throw;
+        }
+        return nd;
+    }
+
+    // trim capacity to newCap (>= size_); 0 hands the buffer back entirely
+    void trimTo(std::size_t newCap) {
+        if (newCap >= cap_) return;
+        if (newCap == 0) {
+            deallocate(data_, cap_);
+            data_ = nullptr; cap_ = 0;
+        } else {
+            reallocate(newCap);
+        }
+    }
+
+    // ask the shrink policy after a removal; compiles away for NeverShrink.
+    // Best effort: if the smaller buffer can't be had, keep the big one.
+    void maybeShrink() {
+        if constexpr (!std::is_same<Shrink, NeverShrink>::value) {
+            try { trimTo(Shrink::shrinkCapacity(size_, cap_)); } catch (...) {}
+        }
+    }
+
+    void shrinkTo(std::size_t n) {
+        destroyRange(data_ + n, data_ + size_);
+        size_ = n;
+    }
+
+    void release() {
+        destroyRange(data_, data_ + size_);
+        deallocate(data_, cap_);
+        data_ = nullptr; size_ = 0; cap_ = 0;
+    }
+
 public:
     Vector() = default;
-    ~Vector() { delete[] data_; }
+    ~Vector() { release(); }
 
     // copy/move
     Vector(const Vector& rhs) : data_(nullptr), size_(rhs.size_), cap_(rhs.cap_) {
-        if (cap_) {
-            data_ = new T[cap_];
-            for (std::size_t i = 0; i < size_; ++i) data_[i] = rhs.data_[i];
-        }
+        data_ = cloneBuffer(rhs, cap_);
     }
     Vector& operator=(const Vector& rhs) {
         if (this != &rhs) {
-            T* nd = nullptr;
-            if (rhs.cap_) {
-                nd = new T[rhs.cap_];
-                for (std::size_t i = 0; i < rhs.size_; ++i) nd[i] = rhs.data_[i];
-            }
-            delete[] data_;
+            T* nd = cloneBuffer(rhs, rhs.cap_);
+            release();
             data_ = nd; size_ = rhs.size_; cap_ = rhs.cap_;
         }
         return *this;
@@ -60,7 +285,7 @@ public:
     }
     Vector& operator=(Vector&& rhs) noexcept {
         if (this != &rhs) {
-            delete[] data_;
+            release();
             data_ = rhs.data_;
             size_ = rhs.size_;
             cap_ = rhs.cap_;
@@ -74,6 +299,10 @@ public:
     bool        empty()    const { return size_ == 0; }
     std::size_t capacity() const { return cap_; }
 
+    // memory accounting: bytes holding live elements vs bytes allocated
+    std::size_t bytesUsed()     const { return size_ * sizeof(T); }
+    std::size_t bytesRetained() const { return cap_ * sizeof(T); }
+
     // element access
     T& operator[](std::size_t i) { return data_[i]; }
     const T& operator[](std::size_t i) const { return data_[i]; }
@@ -87,20 +316,152 @@ public:
         return data_[i];
     }
 
+    // iteration helpers
+    T* data() { return data_; }
+    const T* data() const { return data_; }
+    T* begin() { return data_; }
+    T* end() { return data_ + size_; }
+    const T* begin() const { return data_; }
+    const T* end()   const { return data_ + size_; }
+
     // modifiers
-    void push_back(const T& x) {
-        growIfNeeded(size_ + 1);
-        data_[size_++] = x;
+    void push_back(const T& x) { emplace_back(x); }
+    void push_back(T&& x) { emplace_back(std::move(x)); }
+
+    template <class... Args>
+    T& emplace_back(Args&&... args) {
+        if (size_ == cap_) growAndEmplace(std::forward<Args>(args)...);
+        else {
+            ::new (static_cast<void*>(data_ + size_)) T(std::forward<Args>(args)...);
+            ++size_;
+        }
+        return data_[size_ - 1];
     }
-    void push_back(T&& x) {
-        growIfNeeded(size_ + 1);
-        data_[size_++] = std::move(x);
+
+    // make room for at least n elements without changing size()
+    void reserve(std::size_t n) {
+        if (n > cap_) reallocate(n);
+    }
+
+    // append [first, last) at the back; one reallocation at most when the
+    // length of the range is known up front (forward iterators)
+    template <class It, typename std::enable_if<!std::is_integral<It>::value, int>::type = 0>
+    void append(It first, It last) {
+        if constexpr (isForward<It>()) {
+            std::size_t n = (std::size_t)std::distance(first, last);
+            if (size_ + n > cap_) {
+                reallocateWith(nextCapacity(size_ + n), size_, n, [&](T* p) {
+                    std::uninitialized_copy(first, last, p);
+                });
+            } else {
+                std::uninitialized_copy(first, last, data_ + size_);
+                size_ += n;
+            }
+        } else {
+            for (; first != last; ++first) emplace_back(*first);
+        }
+    }
+    void append(std::initializer_list<T> il) { append(il.begin(), il.end()); }
+
+    // insert [first, last) before index pos (0..size())
+    template <class It, typename std::enable_if<!std::is_integral<It>::value, int>::type = 0>
+    void insert(std::size_t pos, It first, It last) {
+        if (pos > size_) throw std::out_of_range("insert");
+        if constexpr (isForward<It>()) {
+            std::size_t n = (std::size_t)std::distance(first, last);
+            if (size_ + n > cap_) {
+                reallocateWith(nextCapacity(size_ + n), pos, n, [&](T* p) {
+                    std::uninitialized_copy(first, last, p);
+                });
+                return;
+            }
+        }
+        // room already (or unknown length): append, then rotate into place
+        std::size_t oldSize = size_;
+        append(first, last);
+        std::rotate(data_ + pos, data_ + oldSize, data_ + size_);
+    }
+    void insert(std::size_t pos, std::initializer_list<T> il) { insert(pos, il.begin(), il.end()); }
+
+    // grow (constructing new slots from value) or shrink to n elements
+    void resize(std::size_t n, const T& value) {
+        if (n <= size_) { shrinkTo(n); maybeShrink(); return; }
+        std::size_t extra = n - size_;
+        if constexpr (std::is_trivially_copyable<T>::value) {
+            T v(value);                               // value may be one of ours
+            growIfNeeded(n);
+            std::uninitialized_fill_n(data_ + size_, extra, v);
+            size_ = n;
+        } else if (n > cap_) {
+            reallocateWith(nextCapacity(n), size_, extra, [&](T* p) {
+                std::uninitialized_fill_n(p, extra, value);
+            });
+        } else {
+            std::uninitialized_fill_n(data_ + size_, extra, value);
+            size_ = n;
+        }
+    }
+    void resize(std::size_t n) {
+        if (n <= size_) { shrinkTo(n); maybeShrink(); return; }
+        growIfNeeded(n);
+        std::uninitialized_value_construct_n(data_ + size_, n - size_);
+        size_ = n;
+    }
+
+    // replace the contents with [first, last)
+    template <class It, typename std::enable_if<!std::is_integral<It>::value, int>::type = 0>
+    void assign(It first, It last) {
+        if constexpr (isForward<It>()) {
+            std::size_t n = (std::size_t)std::distance(first, last);
+            if (n > cap_) {
+                Vector tmp;
+                tmp.reallocateWith(n, 0, n, [&](T* p) { std::uninitialized_copy(first, last, p); });
+                *this = std::move(tmp);
+            } else if (n <= size_) {
+                std::copy(first, last, data_);        // the range may be our own tail
+                shrinkTo(n);
+            } else {
+                It mid = first;
+                std::advance(mid, size_);
+                std::copy(first, mid, data_);
+                std::uninitialized_copy(mid, last, data_ + size_);
+                size_ = n;
+            }
+        } else {
+            clear();
+            append(first, last);
+        }
     }
+    void assign(std::initializer_list<T> il) { assign(il.begin(), il.end()); }
+    void assign(std::size_t n, const T& value) {
+        if (n > cap_) {
+            Vector tmp;
+            tmp.reallocateWith(n, 0, n, [&](T* p) { std::uninitialized_fill_n(p, n, value); });
+            *this = std::move(tmp);
+        } else {
+            T v(value);                               // value may be one of ours
+            std::size_t common = (n < size_) ? n : size_;
+            std::fill_n(data_, common, v);
+            if (n > size_) std::uninitialized_fill_n(data_ + size_, n - size_, v);
+            else shrinkTo(n);
+            size_ = n;
+        }
+    }
+
     void pop_back() {
         if (size_ == 0) throw std::out_of_range("pop_back on empty vector");
         --size_;
+        data_[size_].~T();
+        maybeShrink();
     }
-    void clear() { size_ = 0; } // leave capacity alone
+    void clear() {                      // capacity is up to the shrink policy
+        destroyRange(data_, data_ + size_);
+        size_ = 0;
+        maybeShrink();
+    }
+
+    // drop spare capacity regardless of policy; an empty vector frees its buffer
+    void shrink_to_fit() { trimTo(size_); }
 };
 
 #endif